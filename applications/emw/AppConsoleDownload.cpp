@@ -20,10 +20,12 @@
 #include "EmwAddress.hpp"
 #include "EmwApiEmw.hpp"
 #include "EmwNetworkStack.hpp"
+#include "EmwSocketReadAhead.hpp"
 #include "stm32u5xx_hal.h"
 #include <cinttypes>
 #include <cstring>
 #include <cstdio>
+#include <cstdlib>
 #include <memory>
 #include <stdexcept>
 #include <system_error>
@@ -37,6 +39,8 @@ static std::uint16_t HostToNetworkShort(std::uint16_t hostShort);
 AppConsoleDownload::AppConsoleDownload(EmwApiEmw& emw) noexcept
   : emw(emw)
   , userDownloadLength(0)
+  , readAheadDepth(0)
+  , connectionPool()
 {
   STD_PRINTF("AppConsoleDownload::AppConsoleDownload()>\n")
   STD_PRINTF("AppConsoleDownload::AppConsoleDownload(): %p\n", static_cast<const void*>(&emw))
@@ -46,6 +50,7 @@ AppConsoleDownload::AppConsoleDownload(EmwApiEmw& emw) noexcept
 AppConsoleDownload::~AppConsoleDownload(void) noexcept
 {
   STD_PRINTF("AppConsoleDownload::~AppConsoleDownload()>\n")
+  this->closeConnections();
   STD_PRINTF("AppConsoleDownload::~AppConsoleDownload()< %p\n", static_cast<const void*>(&emw))
 }
 
@@ -58,10 +63,12 @@ std::int32_t AppConsoleDownload::execute(std::int32_t argc, char *argvPtrs[]) no
   bool use_ipv6 = false;
   char *host_name_ptr = nullptr;
   const char *http_request_ptr;
+  std::uint32_t benchmark_count = 0U;
 
   STD_PRINTF("AppConsoleDownload::execute()>\n")
 
   this->userDownloadLength = AppConsoleDownload::DOWNLOAD_LIMITED_SIZE;
+  this->readAheadDepth = 0U;
 
   if (argc == 1) {
     host_request_string_ptr = AppConsoleDownload::HOST_REQUEST_STRING;
@@ -75,6 +82,12 @@ std::int32_t AppConsoleDownload::execute(std::int32_t argc, char *argvPtrs[]) no
         else if (0 == std::strncmp("-l", argvPtrs[i], 2)) {
           this->userDownloadLength = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
         }
+        else if (0 == std::strncmp("-r", argvPtrs[i], 2)) {
+          this->readAheadDepth = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+        }
+        else if (0 == std::strncmp("-n", argvPtrs[i], 2)) {
+          benchmark_count = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+        }
         else {
           host_request_string_ptr = argvPtrs[i];
         }
@@ -113,7 +126,10 @@ std::int32_t AppConsoleDownload::execute(std::int32_t argc, char *argvPtrs[]) no
 // }
 
     (void) std::printf("%s: \"%s\"\n", this->getName(), host_request_string_ptr);
-    if (use_ipv6) {
+    if (0U != benchmark_count) {
+      status = this->doBenchmark(host_name_ptr, http_request_ptr, benchmark_count, use_ipv6);
+    }
+    else if (use_ipv6) {
       status = this->doDownload6(reinterpret_cast<const char(&)[128]>(* &host_name_ptr[0]));
     }
     else {
@@ -124,6 +140,103 @@ std::int32_t AppConsoleDownload::execute(std::int32_t argc, char *argvPtrs[]) no
   return status;
 }
 
+void AppConsoleDownload::closeConnections(void) noexcept
+{
+  for (AppConsoleDownload::Connection_t &connection : this->connectionPool) {
+    if (0 <= connection.socket) {
+      (void) this->emw.socketClose(connection.socket);
+      connection.socket = -1;
+    }
+  }
+}
+
+std::int32_t AppConsoleDownload::doBenchmark(const char *hostStringPtr, const char *requestStringPtr,
+    std::uint32_t count, bool useIpv6) noexcept
+{
+  std::int32_t status = 0;
+  char host_string[128] = {""};
+  std::uint16_t port = AppConsoleDownload::REMOTE_TCP_PORT;
+  AppConsoleDownload::Timing_t new_timing;
+  AppConsoleDownload::Timing_t pooled_timing;
+  std::uint32_t reused_count = 0U;
+
+  (void) std::strncpy(host_string, hostStringPtr, sizeof(host_string) - 1U);
+  /* An IPv4 host may come with its port, as in "host:8080". */
+  if (!useIpv6) {
+    char *const port_ptr = std::strchr(host_string, ':');
+
+    if (nullptr != port_ptr) {
+      *port_ptr = '\0';
+      port = static_cast<std::uint16_t>(std::atoi(port_ptr + 1));
+    }
+  }
+  (void) std::printf("%s: %" PRIu32 " requests of \"%s\" to %s:%" PRIu32 "\n", this->getName(), count,
+                     requestStringPtr, host_string, static_cast<std::uint32_t>(port));
+
+  /* Without reuse, each request pays the name resolution and the TCP connection. */
+  (void) std::printf("%s: new connection per request ", this->getName());
+  for (std::uint32_t i = 0U; (i < count) && (0 == status); i++) {
+    const std::uint32_t tstart = HAL_GetTick();
+    const std::int32_t socket = this->openConnection(host_string, port, useIpv6);
+
+    if ((0 > socket) || (0 > this->doRequest(socket, host_string, requestStringPtr, false))) {
+      (void) std::printf("x");
+      status = -1;
+    }
+    else {
+      new_timing.add(HAL_GetTick() - tstart);
+      (void) std::printf(".");
+    }
+    if (0 <= socket) {
+      (void) this->emw.socketClose(socket);
+    }
+  }
+  (void) std::printf("\n");
+
+  /* With the pool, only the first request or the one after a close by the server pays them. */
+  (void) std::printf("%s: pooled keep-alive connection ", this->getName());
+  for (std::uint32_t i = 0U; (i < count) && (0 == status); i++) {
+    const std::uint32_t tstart = HAL_GetTick();
+    bool is_reused = false;
+    std::int32_t socket = this->takeConnection(host_string, port, useIpv6, is_reused);
+    std::int32_t request_status = (0 > socket) ? -1 : this->doRequest(socket, host_string, requestStringPtr, true);
+
+    /* The server may have closed the idle connection meanwhile, so retry once with a new one. */
+    if ((0 > request_status) && is_reused) {
+      (void) this->emw.socketClose(socket);
+      is_reused = false;
+      socket = this->openConnection(host_string, port, useIpv6);
+      request_status = (0 > socket) ? -1 : this->doRequest(socket, host_string, requestStringPtr, true);
+    }
+    if (0 > request_status) {
+      (void) std::printf("x");
+      status = -1;
+      if (0 <= socket) {
+        (void) this->emw.socketClose(socket);
+      }
+    }
+    else {
+      pooled_timing.add(HAL_GetTick() - tstart);
+      if (is_reused) {
+        reused_count++;
+      }
+      if (0 == request_status) {
+        this->giveBackConnection(host_string, port, socket);
+      }
+      else {
+        (void) this->emw.socketClose(socket);
+      }
+      (void) std::printf(is_reused ? "." : "o");
+    }
+  }
+  (void) std::printf("\n");
+  this->printTiming("new", new_timing);
+  this->printTiming("pooled", pooled_timing);
+  (void) std::printf("%s: %" PRIu32 " of %" PRIu32 " pooled requests reused a connection\n", this->getName(),
+                     reused_count, pooled_timing.count);
+  return status;
+}
+
 std::int32_t AppConsoleDownload::doDownload(const char (&serverNameString)[128]) noexcept
 {
   std::int32_t status = 0;
@@ -236,6 +349,7 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
 {
   std::int32_t status = -1;
   std::unique_ptr<std::uint8_t[]> buffer_ptr(new std::uint8_t[EmwNetworkStack::NETWORK_BUFFER_SIZE]);
+  std::unique_ptr<EmwSocketReadAhead> read_ahead_ptr;
 
   (void) std::printf("%s: downloading file %s from \"%s\"\n", this->getName(), "/image.iso", serverNameString);
 
@@ -248,6 +362,7 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
     AppConsoleDownload::HttpContext_t http_ctx;
     const std::uint32_t buffer_size = EmwNetworkStack::NETWORK_BUFFER_SIZE - 1;
     std::uint32_t ret_size = 0;
+    std::uint32_t body_size = 0;
     std::uint64_t length = 0;
     std::uint32_t cpt_count = 0;
 
@@ -259,7 +374,19 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
                          reinterpret_cast<std::uint8_t (&)[]>(* buffer_ptr.get()),
                          std::strlen(reinterpret_cast<char *>(buffer_ptr.get())), 0);
 
-    if (this->readResponse(socket, buffer_ptr.get(), buffer_size, ret_size) != 0) {
+    /* Started after the request, a pending read-ahead receive holds the IPC until data come. */
+    if (0U != this->readAheadDepth) {
+      read_ahead_ptr.reset(new EmwSocketReadAhead(this->emw, socket, this->readAheadDepth));
+      if (read_ahead_ptr->isValid()) {
+        (void) std::printf("%s: read-ahead of %" PRIu32 " chunks\n", this->getName(), this->readAheadDepth);
+      }
+      else {
+        (void) std::printf("%s: read-ahead not available\n", this->getName());
+        read_ahead_ptr.reset();
+      }
+    }
+
+    if (this->readResponse(socket, read_ahead_ptr.get(), buffer_ptr.get(), buffer_size, ret_size, body_size) != 0) {
       throw std::runtime_error("no answer from HTTP server");
     }
 
@@ -277,6 +404,15 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
                          this->getName(), this->userDownloadLength, AppConsoleDownload::REPORT_TIMEPERIOD_MS);
       length = this->userDownloadLength;
     }
+    /* The first body bytes came with the header. */
+    if (body_size > length) {
+      body_size = static_cast<std::uint32_t>(length);
+    }
+    length -= body_size;
+    cpt_count += body_size;
+    if (nullptr != read_ahead_ptr) {
+      read_ahead_ptr->setReadLimit(static_cast<std::uint32_t>(length));
+    }
 
     local_start_time_in_ms = start_time_in_ms = HAL_GetTick();
 
@@ -284,9 +420,9 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
       std::uint32_t elapsed_time_in_ms;
       const std::uint32_t size_in_bytes = (buffer_size < length) ? buffer_size : static_cast<std::uint32_t>(length);
 
-      const std::int32_t count = this->emw.socketReceive(socket,
+      const std::int32_t count = this->receive(socket, read_ahead_ptr.get(),
                                  reinterpret_cast<std::uint8_t (&)[]>(* buffer_ptr.get()),
-                                 size_in_bytes, 0);
+                                 static_cast<std::int32_t>(size_in_bytes));
       if (count == -1) {
         break;
       }
@@ -316,6 +452,7 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
         length = 0;
       }
     }
+    read_ahead_ptr.reset();
     (void) this->emw.socketShutDown(socket, 2);
     (void) this->emw.socketClose(socket);
     {
@@ -330,43 +467,195 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
   catch (const std::runtime_error &error) {
     (void) std::printf("%s: %s\n", this->getName(), error.what());
     status = -1;
+    read_ahead_ptr.reset();
     (void) this->emw.socketShutDown(socket, 2);
     (void) this->emw.socketClose(socket);
   }
   return status;
 }
 
-std::int32_t AppConsoleDownload::readResponse(std::int32_t socket, unsigned char *headerPtr, std::uint32_t maximumSize,
-    std::uint32_t &retSize) const noexcept
+/* Sends one GET and reads the whole response.
+ * Returns 0 when the connection can carry another request, 1 when the server closes it, -1 on error.
+ */
+std::int32_t AppConsoleDownload::doRequest(std::int32_t socket, const char *hostStringPtr,
+    const char *requestStringPtr, bool keepAlive) const noexcept
 {
-  char *string_ptr = reinterpret_cast<char *>(headerPtr);
-  std::uint32_t header_size = maximumSize;
-  std::uint32_t count = 0;
+  std::int32_t status = -1;
+  std::unique_ptr<std::uint8_t[]> buffer_ptr(new std::uint8_t[EmwNetworkStack::NETWORK_BUFFER_SIZE]);
+  const std::uint32_t buffer_size = EmwNetworkStack::NETWORK_BUFFER_SIZE - 1;
 
-  retSize = 0U;
+  if (nullptr != buffer_ptr) {
+    AppConsoleDownload::HttpContext_t http_ctx;
+    std::uint32_t ret_size = 0;
+    std::uint32_t body_size = 0;
+    std::int32_t request_length;
 
-  while (header_size > 0) {
-    std::int32_t ret = this->emw.socketReceive(socket,
-                       reinterpret_cast<std::uint8_t (&)[]>(* string_ptr), 1, 0);
-    if (ret < 0) {
-      return ret;
+    *(buffer_ptr.get() + buffer_size) = '\0';
+    (void) std::snprintf(reinterpret_cast<char *>(buffer_ptr.get()), buffer_size,
+                         "GET %s HTTP/1.1\r\nHost:%s\r\nUser-Agent:EMW\r\nConnection:%s\r\n\r\n",
+                         requestStringPtr, hostStringPtr, keepAlive ? "keep-alive" : "close");
+    request_length = static_cast<std::int32_t>(std::strlen(reinterpret_cast<char *>(buffer_ptr.get())));
+
+    if ((request_length == this->emw.socketSendAll(socket,
+         reinterpret_cast<std::uint8_t (&)[]>(* buffer_ptr.get()), request_length, 0)) \
+        && (0 == this->readResponse(socket, nullptr, buffer_ptr.get(), buffer_size, ret_size, body_size))) {
+      if (0 == this->testResponse(http_ctx, buffer_ptr.get())) {
+        /* Without a length, the end of the body is the close of the connection. */
+        const bool has_length = (static_cast<std::uint64_t>(-1) != http_ctx.contentLength);
+        std::uint64_t length = http_ctx.contentLength;
+
+        if (has_length) {
+          length = (length > body_size) ? (length - body_size) : 0U;
+        }
+
+        status = (has_length && keepAlive && http_ctx.keepAlive) ? 0 : 1;
+        while ((!has_length) || (0U != length)) {
+          const std::uint32_t size_in_bytes = (buffer_size < length) ? buffer_size : static_cast<std::uint32_t>(length);
+          const std::int32_t count = this->emw.socketReceive(socket,
+                                     reinterpret_cast<std::uint8_t (&)[]>(* buffer_ptr.get()),
+                                     static_cast<std::int32_t>(size_in_bytes), 0);
+          if (0 >= count) {
+            if (has_length) {
+              status = -1;
+            }
+            break;
+          }
+          length = (length > static_cast<std::uint64_t>(count)) ? (length - static_cast<std::uint64_t>(count)) : 0U;
+        }
+      }
     }
+  }
+  return status;
+}
 
-    string_ptr++;
-    header_size--;
-    count++;
-    if ((count > 4) && (std::strncmp(string_ptr - 4, "\r\n\r\n", 4) == 0)) {
+void AppConsoleDownload::giveBackConnection(const char *hostStringPtr, std::uint16_t port, std::int32_t socket) noexcept
+{
+  AppConsoleDownload::Connection_t *connection_ptr = &this->connectionPool[0];
+
+  /* Takes a free entry, otherwise closes the least recently used connection. */
+  for (AppConsoleDownload::Connection_t &connection : this->connectionPool) {
+    if (0 > connection.socket) {
+      connection_ptr = &connection;
       break;
     }
+    if ((connection.lastUseInMs - connection_ptr->lastUseInMs) > (UINT32_MAX / 2U)) {
+      connection_ptr = &connection;
+    }
   }
+  if (0 <= connection_ptr->socket) {
+    (void) this->emw.socketClose(connection_ptr->socket);
+  }
+  (void) std::strncpy(connection_ptr->hostString, hostStringPtr, sizeof(connection_ptr->hostString) - 1U);
+  connection_ptr->hostString[sizeof(connection_ptr->hostString) - 1U] = '\0';
+  connection_ptr->port = port;
+  connection_ptr->socket = socket;
+  connection_ptr->lastUseInMs = HAL_GetTick();
+}
 
-  if (header_size == 0) {
-    return -1;
+std::int32_t AppConsoleDownload::openConnection(const char *hostStringPtr, std::uint16_t port, bool useIpv6) noexcept
+{
+  std::int32_t socket = -1;
+  EmwAddress::SockAddrIn_t s_address_in(HostToNetworkShort(port), 0);
+  EmwAddress::SockAddrIn6_t s_address_in6;
+  const EmwAddress::SockAddr_t *s_address_ptr = nullptr;
+  std::int32_t s_address_size = 0;
+  char host_name_string[255] = {""};
+
+  (void) std::strncpy(host_name_string, hostStringPtr, sizeof(host_name_string) - 1U);
+  if (useIpv6) {
+    const EmwAddress::AddrInfo_t hints(0, EMW_AF_INET6, EMW_SOCK_STREAM, EMW_IPPROTO_TCP);
+    const char empty[255] = {""};
+    EmwAddress::AddrInfo_t result;
+
+    if (0 <= this->emw.socketGetAddrInfo(host_name_string, empty, hints, result)) {
+      s_address_in6.port = HostToNetworkShort(port);
+      s_address_in6.in6Addr.un.u32Addr[0] = result.sAddr.data2[1];
+      s_address_in6.in6Addr.un.u32Addr[1] = result.sAddr.data2[2];
+      s_address_in6.in6Addr.un.u32Addr[2] = result.sAddr.data3[0];
+      s_address_in6.in6Addr.un.u32Addr[3] = result.sAddr.data3[1];
+      s_address_ptr = reinterpret_cast<const EmwAddress::SockAddr_t *>(&s_address_in6);
+      s_address_size = sizeof(s_address_in6);
+    }
+  }
+  else {
+    if (0 <= this->emw.socketGetHostByName(reinterpret_cast<EmwAddress::SockAddr_t &>(s_address_in),
+                                           host_name_string)) {
+      s_address_ptr = reinterpret_cast<const EmwAddress::SockAddr_t *>(&s_address_in);
+      s_address_size = sizeof(s_address_in);
+    }
+  }
+  if (nullptr != s_address_ptr) {
+    const std::int32_t timeout_in_ms = AppConsoleDownload::TIMEOUT_10S_DEFINED;
+
+    socket = this->emw.socketCreate(useIpv6 ? EMW_AF_INET6 : EMW_AF_INET, EMW_SOCK_STREAM, EMW_IPPROTO_TCP);
+    if ((0 <= socket) \
+        && ((0 != this->emw.socketSetSockOpt(socket, EMW_SOL_SOCKET, EmwSockOptVal::eEMW_SO_RCVTIMEO,
+                                             &timeout_in_ms, sizeof(timeout_in_ms))) \
+            || (0 != this->emw.socketSetSockOpt(socket, EMW_SOL_SOCKET, EmwSockOptVal::eEMW_SO_SNDTIMEO,
+                                                &timeout_in_ms, sizeof(timeout_in_ms))) \
+            || (0 != this->emw.socketConnect(socket, *s_address_ptr, s_address_size)))) {
+      (void) this->emw.socketClose(socket);
+      socket = -1;
+    }
   }
+  return socket;
+}
 
-  retSize = count;
+void AppConsoleDownload::printTiming(const char *nameStringPtr, const AppConsoleDownload::Timing_t &timing) const noexcept
+{
+  if (0U != timing.count) {
+    (void) std::printf("%s: %-6s %" PRIu32 " requests, min %" PRIu32 " ms, avg %" PRIu32 " ms, max %" PRIu32 " ms\n",
+                       this->getName(), nameStringPtr, timing.count, timing.min,
+                       static_cast<std::uint32_t>(timing.sum / timing.count), timing.max);
+  }
+}
 
-  return 0;
+/* Reads the header by chunks, as a single byte costs the same IPC round trip as a full chunk.
+ * The header is NUL terminated in place of its last "\r", the body bytes received with it follow it.
+ */
+std::int32_t AppConsoleDownload::readResponse(std::int32_t socket, EmwSocketReadAhead *readAheadPtr,
+    unsigned char *headerPtr, std::uint32_t maximumSize, std::uint32_t &retSize, std::uint32_t &bodySize) const noexcept
+{
+  std::uint32_t count = 0U;
+
+  retSize = 0U;
+  bodySize = 0U;
+
+  while (count < maximumSize) {
+    const std::int32_t ret = this->receive(socket, readAheadPtr,
+                                           reinterpret_cast<std::uint8_t (&)[]>(headerPtr[count]),
+                                           static_cast<std::int32_t>(maximumSize - count));
+    if (ret < 0) {
+      return ret;
+    }
+    if (ret == 0) {
+      return -1;
+    }
+    {
+      /* The end of the header may straddle the previous chunk. */
+      std::uint32_t i = (count > 3U) ? (count - 3U) : 0U;
+
+      count += static_cast<std::uint32_t>(ret);
+      for (; (i + 4U) <= count; i++) {
+        if (std::memcmp(&headerPtr[i], "\r\n\r\n", 4U) == 0) {
+          headerPtr[i + 2U] = '\0';
+          retSize = i + 4U;
+          bodySize = count - retSize;
+          return 0;
+        }
+      }
+    }
+  }
+  return -1;
+}
+
+std::int32_t AppConsoleDownload::receive(std::int32_t socket, EmwSocketReadAhead *readAheadPtr,
+    std::uint8_t (&buffer)[], std::int32_t bufferLength) const noexcept
+{
+  if (nullptr != readAheadPtr) {
+    return readAheadPtr->receive(buffer, bufferLength);
+  }
+  return this->emw.socketReceive(socket, buffer, bufferLength, 0);
 }
 
 std::uint32_t AppConsoleDownload::serviceLines(unsigned char *bufferPtr, char *linePtrs[],
@@ -450,16 +739,37 @@ void AppConsoleDownload::splitHostRequest(const char *urlStringPtr, char * &host
   }
 }
 
+std::int32_t AppConsoleDownload::takeConnection(const char *hostStringPtr, std::uint16_t port, bool useIpv6,
+    bool &isReused) noexcept
+{
+  std::int32_t socket = -1;
+
+  for (AppConsoleDownload::Connection_t &connection : this->connectionPool) {
+    if ((0 <= connection.socket) && (port == connection.port) \
+        && (0 == std::strncmp(hostStringPtr, connection.hostString, sizeof(connection.hostString)))) {
+      socket = connection.socket;
+      connection.socket = -1;
+      break;
+    }
+  }
+  isReused = (0 <= socket);
+  if (!isReused) {
+    socket = this->openConnection(hostStringPtr, port, useIpv6);
+  }
+  return socket;
+}
+
 std::int32_t AppConsoleDownload::testResponse(AppConsoleDownload::HttpContext_t &context,
     unsigned char *bufferPtr) const noexcept
 {
-  char *line_ptrs[10] = {nullptr};
+  char *line_ptrs[16] = {nullptr};
   const std::uint32_t line_ptrs_count = this->serviceLines(bufferPtr, &line_ptrs[0],
                                         sizeof(line_ptrs) / sizeof(line_ptrs[0]));
 
   context.contentLength = -1;
   context.status = AppConsoleDownload::HTTP_RESPONSE_BAD_REQUEST;
   context.posFile = 0;
+  context.keepAlive = true;
 
   if (line_ptrs_count < 1) {
     return -1;
@@ -482,6 +792,9 @@ std::int32_t AppConsoleDownload::testResponse(AppConsoleDownload::HttpContext_t
         context.contentLength = length;
       }
     }
+    else if (std::strncmp(line_ptrs[a], "Connection", strlen("Connection")) == 0) {
+      context.keepAlive = (nullptr == std::strstr(line_ptrs[a], "close"));
+    }
   }
   if ((context.status < AppConsoleDownload::HTTP_RESPONSE_OK) \
       || (context.status >= AppConsoleDownload::HTTP_RESPONSE_MULTIPLE_CHOICES)) {
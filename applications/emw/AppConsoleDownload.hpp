@@ -21,6 +21,7 @@
 #include "Console.hpp"
 
 class EmwApiEmw;
+class EmwSocketReadAhead;
 
 class AppConsoleDownload final : public Cmd {
   public:
@@ -32,7 +33,7 @@ class AppConsoleDownload final : public Cmd {
   public:
     const char *getComment(void) const noexcept override
     {
-      return "http [-l<size>] [-6] <req> (default is http://test-debit.free.fr/image.iso)";
+      return "http [-l<size>] [-r<depth>] [-n<count>] [-6] <req> (default is http://test-debit.free.fr/image.iso)";
     }
   public:
     const char *getName(void) const noexcept override
@@ -42,13 +43,44 @@ class AppConsoleDownload final : public Cmd {
 
   private:
     typedef struct HttpContext_s {
-      constexpr HttpContext_s(void) : socket(0), status(-1), contentLength(0), posFile(0) {}
+      constexpr HttpContext_s(void) : socket(0), status(-1), contentLength(0), posFile(0), keepAlive(true) {}
       std::int32_t socket;
       std::uint32_t status;
       std::uint64_t contentLength;
       std::uint64_t posFile;
+      bool keepAlive;
     } HttpContext_t;
 
+  private:
+    typedef struct Connection_s {
+      constexpr Connection_s(void) : hostString{'\0'}, port(0U), socket(-1), lastUseInMs(0U) {}
+      char hostString[128];
+      std::uint16_t port;
+      std::int32_t socket;
+      std::uint32_t lastUseInMs;
+    } Connection_t;
+
+  private:
+    typedef struct Timing_s {
+      constexpr Timing_s(void) : count(0U), min(UINT32_MAX), max(0U), sum(0U) {}
+      void add(std::uint32_t value) noexcept
+      {
+        this->count++;
+        this->min = (value < this->min) ? value : this->min;
+        this->max = (value > this->max) ? value : this->max;
+        this->sum += value;
+      }
+      std::uint32_t count;
+      std::uint32_t min;
+      std::uint32_t max;
+      std::uint64_t sum;
+    } Timing_t;
+
+  private:
+    void closeConnections(void) noexcept;
+  private:
+    std::int32_t doBenchmark(const char *hostStringPtr, const char *requestStringPtr, std::uint32_t count,
+                             bool useIpv6) noexcept;
   private:
     std::int32_t doDownload(const char (&serverNameString)[128]) noexcept;
   private:
@@ -56,8 +88,21 @@ class AppConsoleDownload final : public Cmd {
   private:
     std::int32_t doDownloadFile(std::int32_t socket, const char (&serverNameString)[128]) const noexcept;
   private:
-    std::int32_t readResponse(std::int32_t socket, unsigned char *headerPtr, std::uint32_t maximumSize,
-                              std::uint32_t &retSize) const noexcept;
+    std::int32_t doRequest(std::int32_t socket, const char *hostStringPtr, const char *requestStringPtr,
+                           bool keepAlive) const noexcept;
+  private:
+    void giveBackConnection(const char *hostStringPtr, std::uint16_t port, std::int32_t socket) noexcept;
+  private:
+    std::int32_t openConnection(const char *hostStringPtr, std::uint16_t port, bool useIpv6) noexcept;
+  private:
+    void printTiming(const char *nameStringPtr, const AppConsoleDownload::Timing_t &timing) const noexcept;
+  private:
+    std::int32_t readResponse(std::int32_t socket, EmwSocketReadAhead *readAheadPtr,
+                              unsigned char *headerPtr, std::uint32_t maximumSize, std::uint32_t &retSize,
+                              std::uint32_t &bodySize) const noexcept;
+  private:
+    std::int32_t receive(std::int32_t socket, EmwSocketReadAhead *readAheadPtr,
+                         std::uint8_t (&buffer)[], std::int32_t bufferLength) const noexcept;
   private:
     char *seekTo(char *stringPtr, char key) const noexcept;
   private:
@@ -68,6 +113,8 @@ class AppConsoleDownload final : public Cmd {
     std::uint32_t serviceLines(unsigned char *bufferPtr, char *linePtrs[], uint32_t maxLines) const noexcept;
   private:
     void splitHostRequest(const char *urlStringPtr, char * &hostStringPtr, const char * &requestStringPtr) const noexcept;
+  private:
+    std::int32_t takeConnection(const char *hostStringPtr, std::uint16_t port, bool useIpv6, bool &isReused) noexcept;
   private:
     std::int32_t testResponse(AppConsoleDownload::HttpContext_t &context, unsigned char *bufferPtr) const noexcept;
 
@@ -75,6 +122,8 @@ class AppConsoleDownload final : public Cmd {
     EmwApiEmw &emw;
   private:
     std::uint32_t userDownloadLength;
+  private:
+    std::uint32_t readAheadDepth;
   private:
     static const std::uint32_t DOWNLOAD_LIMITED_SIZE = 140000;
   private:
@@ -93,4 +142,9 @@ class AppConsoleDownload final : public Cmd {
     static const std::int32_t TIMEOUT_10S_DEFINED = 10000;
   private:
     static const std::uint32_t TRANSFER_SIZE = 2000U;
+  private:
+    static const std::uint32_t CONNECTION_POOL_SIZE = 2U;
+
+  private:
+    AppConsoleDownload::Connection_t connectionPool[CONNECTION_POOL_SIZE];
 };
@@ -19,6 +19,10 @@
 #include "AppConsoleStats.hpp"
 #include "EmwApiCore.hpp"
 #include "EmwApiEmw.hpp"
+#include "EmwCoreHci.hpp"
+#include "EmwNetworkStack.hpp"
+#include "emw_conf.hpp"
+#include "stm32u5xx_hal.h"
 #include <inttypes.h>
 #include <cstdio>
 
@@ -27,6 +31,8 @@
 
 AppConsoleStats::AppConsoleStats(EmwApiEmw& emw) noexcept
   : emw(emw)
+  , lastTick(HAL_GetTick())
+  , lastIpcCount(0U)
 {
   STD_PRINTF("AppConsoleStats::AppConsoleStats()>\n")
   STD_PRINTF("AppConsoleStats::AppConsoleStats()> %p\n", static_cast<const void*>(&emw))
@@ -46,6 +52,62 @@ std::int32_t AppConsoleStats::execute(std::int32_t argc, char *argvPtrs[]) noexc
 
   STD_PRINTF("AppConsoleStats::execute()>\n")
   this->emw.getStatistics();
+  {
+    EmwDnsCache::Statistics_t dns_cache_statistics;
+
+    this->emw.getDnsCacheStatistics(dns_cache_statistics);
+    (void) std::printf(" DNS cache: hit %" PRIu32 ", negative hit %" PRIu32 ", miss %" PRIu32 ","
+                       " expired %" PRIu32 ", evicted %" PRIu32 "\n\n",
+                       dns_cache_statistics.hits, dns_cache_statistics.negativeHits, dns_cache_statistics.misses,
+                       dns_cache_statistics.expirations, dns_cache_statistics.evictions);
+  }
+  {
+    EmwCredentialCache::Statistics_t credential_cache_statistics;
+
+    this->emw.getCredentialCacheStatistics(credential_cache_statistics);
+    (void) std::printf(" Credential cache: uploaded %" PRIu32 ", skipped %" PRIu32 " (%" PRIu32 " bytes,"
+                       " about %" PRIu32 " ms saved), invalidated %" PRIu32 "\n\n",
+                       credential_cache_statistics.uploads, credential_cache_statistics.skips,
+                       credential_cache_statistics.skippedBytes, credential_cache_statistics.savedTimeInMs,
+                       credential_cache_statistics.invalidations);
+  }
+  {
+    EmwNetworkStack::PoolStatistics_t pools_statistics[2];
+
+    EmwNetworkStack::GetPoolStatistics(pools_statistics[0], pools_statistics[1]);
+    for (const EmwNetworkStack::PoolStatistics_t &statistics : pools_statistics) {
+      (void) std::printf(" Buffer pool of %" PRIu32 " bytes: %" PRIu32 " used of %" PRIu32 ", high water mark %" PRIu32
+                         ", exhausted %" PRIu32 "\n", statistics.blockSize, statistics.used,
+                         statistics.blockCount, statistics.highWaterMark, statistics.exhausted);
+    }
+    (void) std::printf("\n");
+  }
+  {
+    EmwCoreHci::NetworkPacketFifo_t::Statistics_t fifo_statistics;
+
+    EmwCoreHci::GetFifoStatistics(fifo_statistics);
+    (void) std::printf(" HCI FIFO: receive thread woken up %" PRIu32 " times, IO thread woken up %" PRIu32 " times\n\n",
+                       fifo_statistics.consumerWakeUps, fifo_statistics.producerWakeUps);
+  }
+#if (defined(EMW_STATS_ON) && (EMW_STATS_ON == 1))
+  {
+    /* Rate of the IPC transactions since the previous call, to measure the cost of the idle sockets for instance. */
+    const std::uint32_t tick = HAL_GetTick();
+    const std::uint32_t ipc_count = EmwStats.cmdGetAnswer + EmwStats.callback;
+    const std::uint32_t elapsed_in_ms = tick - this->lastTick;
+
+    if (0U != elapsed_in_ms) {
+      const std::uint32_t rate_per_ten_seconds = static_cast<std::uint32_t>(
+            (static_cast<std::uint64_t>(ipc_count - this->lastIpcCount) * 10000U) / elapsed_in_ms);
+
+      (void) std::printf(" IPC: %" PRIu32 " transactions in %" PRIu32 " ms, %" PRIu32 ".%" PRIu32 " per second\n\n",
+                         ipc_count - this->lastIpcCount, elapsed_in_ms,
+                         rate_per_ten_seconds / 10U, rate_per_ten_seconds % 10U);
+    }
+    this->lastTick = tick;
+    this->lastIpcCount = ipc_count;
+  }
+#endif /* EMW_STATS_ON */
   STD_PRINTF("AppConsoleStats::execute()<\n")
   return 0;
 }
@@ -42,4 +42,8 @@ class AppConsoleStats final : public Cmd {
 
   private:
     EmwApiEmw &emw;
+  private:
+    std::uint32_t lastTick;
+  private:
+    std::uint32_t lastIpcCount;
 };
@@ -127,9 +127,9 @@ std::int32_t AppConsoleTls::doTlsExchanges(EmwApiBase::Mtls_t tlsMagic) noexcept
   STD_PRINTF("\nAppConsoleTls::doTlsExchanges()>\n")
 
   try {
-    if (emw.tlsSend(tlsMagic, AppConsoleTls::HTTP_REQUEST,
-                    std::strlen(reinterpret_cast<const char *>(&AppConsoleTls::HTTP_REQUEST[0]))) <= 0) {
-      throw std::runtime_error("tlsSend() failed");
+    if (emw.tlsSendAll(tlsMagic, AppConsoleTls::HTTP_REQUEST,
+                       std::strlen(reinterpret_cast<const char *>(&AppConsoleTls::HTTP_REQUEST[0]))) <= 0) {
+      throw std::runtime_error("tlsSendAll() failed");
     }
 
     {
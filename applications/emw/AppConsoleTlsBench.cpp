@@ -0,0 +1,366 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "AppConsoleTlsBench.hpp"
+#include "CycleCounter.hpp"
+#include "EmwAddress.hpp"
+#include "EmwApiEmw.hpp"
+#include "stm32u5xx_hal.h"
+#include <cinttypes>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <system_error>
+
+//#define STD_PRINTF(...) (void) std::printf(__VA_ARGS__);
+#define STD_PRINTF(...)
+
+static std::uint16_t HostToNetworkShort(std::uint16_t hostShort);
+
+
+AppConsoleTlsBench::AppConsoleTlsBench(EmwApiEmw &emw) noexcept
+  : emw(emw)
+  , bufferIn{0U}
+  , bufferOut{0U}
+{
+  STD_PRINTF("AppConsoleTlsBench::AppConsoleTlsBench()>\n")
+  STD_PRINTF("AppConsoleTlsBench::AppConsoleTlsBench(): %p\n", static_cast<const void*>(&emw))
+  STD_PRINTF("AppConsoleTlsBench::AppConsoleTlsBench()<\n")
+}
+
+AppConsoleTlsBench::~AppConsoleTlsBench(void) noexcept
+{
+  STD_PRINTF("AppConsoleTlsBench::~AppConsoleTlsBench()>\n")
+  STD_PRINTF("AppConsoleTlsBench::~AppConsoleTlsBench()< %p\n", static_cast<const void*>(&emw))
+}
+
+/* The echo server must send back what it receives, the sink discards all, the source sends at least the size
+ * of the throughput test, for instance on the LAN:
+ *   openssl req -x509 -newkey rsa:2048 -nodes -subj /CN=bench -keyout key.pem -out cert.pem
+ *   socat OPENSSL-LISTEN:4433,reuseaddr,fork,cert=cert.pem,key=key.pem,verify=0 EXEC:cat
+ *   socat OPENSSL-LISTEN:4434,reuseaddr,fork,cert=cert.pem,key=key.pem,verify=0 SYSTEM:'cat > /dev/null'
+ *   socat OPENSSL-LISTEN:4435,reuseaddr,fork,cert=cert.pem,key=key.pem,verify=0 SYSTEM:'head -c 16M /dev/zero'
+ * A port set to 0 skips the corresponding test.
+ * The server certificate is not verified, the same host and settings give reproducible figures.
+ */
+std::int32_t AppConsoleTlsBench::execute(std::int32_t argc, char *argvPtrs[]) noexcept
+{
+  std::int32_t status = -1;
+  char server_name_string[128] = {""};
+  std::uint16_t port = AppConsoleTlsBench::SERVER_PORT;
+  std::uint16_t sink_port = AppConsoleTlsBench::SINK_SERVER_PORT;
+  std::uint16_t source_port = AppConsoleTlsBench::SOURCE_SERVER_PORT;
+  std::uint32_t handshake_count = AppConsoleTlsBench::HANDSHAKE_COUNT;
+  std::uint32_t latency_count = AppConsoleTlsBench::LATENCY_COUNT;
+  std::uint32_t latency_size = AppConsoleTlsBench::LATENCY_SIZE;
+  std::uint32_t throughput_size = AppConsoleTlsBench::THROUGHPUT_SIZE_IN_KB * 1024U;
+
+  STD_PRINTF("\nAppConsoleTlsBench::execute()>\n")
+
+  (void) std::strncpy(server_name_string, AppConsoleTlsBench::SERVER_NAME_STRING, sizeof(server_name_string) - 1U);
+  for (std::int32_t i = 1; i < argc; i++) {
+    if (nullptr != argvPtrs[i]) {
+      if (0 == std::strncmp("-p", argvPtrs[i], 2)) {
+        port = static_cast<std::uint16_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else if (0 == std::strncmp("-u", argvPtrs[i], 2)) {
+        sink_port = static_cast<std::uint16_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else if (0 == std::strncmp("-d", argvPtrs[i], 2)) {
+        source_port = static_cast<std::uint16_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else if (0 == std::strncmp("-h", argvPtrs[i], 2)) {
+        handshake_count = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else if (0 == std::strncmp("-c", argvPtrs[i], 2)) {
+        latency_count = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else if (0 == std::strncmp("-l", argvPtrs[i], 2)) {
+        latency_size = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else if (0 == std::strncmp("-t", argvPtrs[i], 2)) {
+        throughput_size = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2)) * 1024U;
+      }
+      else {
+        (void) std::strncpy(server_name_string, argvPtrs[i], sizeof(server_name_string) - 1U);
+      }
+    }
+  }
+  if ((0U == latency_size) || (latency_size > AppConsoleTlsBench::BUFFER_SIZE)) {
+    (void) std::printf("%s: message size must be in [1..%" PRIu32 "]\n", this->getName(),
+                       AppConsoleTlsBench::BUFFER_SIZE);
+    return -1;
+  }
+  (void) std::printf("%s: <%s>:%" PRIu32 "\n", this->getName(), server_name_string, static_cast<std::uint32_t>(port));
+  for (std::uint32_t i = 0U; i < AppConsoleTlsBench::BUFFER_SIZE; i++) {
+    this->bufferOut[i] = static_cast<std::uint8_t>(i);
+  }
+  CycleCounter::Start();
+  try {
+    EmwAddress::SockAddrIn_t s_address_in(HostToNetworkShort(port), 0);
+
+    if (0 > this->emw.socketGetHostByName(reinterpret_cast<EmwAddress::SockAddr_t &>(s_address_in),
+                                          reinterpret_cast<const char(&)[255]>(server_name_string))) {
+      throw std::runtime_error("socketGetHostByName() failed");
+    }
+    if (emw.tlsSetVersion(EmwApiEmw::TLS_V1_2_MODE) < 0) {
+      throw std::runtime_error("tlsSetVersion() failed");
+    }
+    if (0 != this->doHandshakes(server_name_string, s_address_in, handshake_count)) {
+      throw std::runtime_error("doHandshakes() failed");
+    }
+    {
+      const EmwApiBase::Mtls_t tls_magic = this->connect(server_name_string, s_address_in);
+
+      if (nullptr == tls_magic) {
+        throw std::runtime_error("tlsConnectSni() failed");
+      }
+      status = this->doLatency(tls_magic, latency_count, latency_size);
+      (void) this->emw.tlsClose(tls_magic);
+    }
+    if ((0 == status) && (0U != sink_port)) {
+      const EmwAddress::SockAddrIn_t s_sink_address_in(HostToNetworkShort(sink_port), s_address_in.inAddr.addr);
+
+      status = this->doUpload(server_name_string, s_sink_address_in, throughput_size);
+    }
+    if ((0 == status) && (0U != source_port)) {
+      const EmwAddress::SockAddrIn_t s_source_address_in(HostToNetworkShort(source_port), s_address_in.inAddr.addr);
+
+      status = this->doDownload(server_name_string, s_source_address_in, throughput_size);
+    }
+  }
+  catch (const std::runtime_error &error) {
+    (void) std::printf("%s: %s\n", this->getName(), error.what());
+    status = -1;
+  }
+  STD_PRINTF("\nAppConsoleTlsBench::execute()<\n\n")
+  return status;
+}
+
+EmwApiBase::Mtls_t AppConsoleTlsBench::connect(const char (&serverNameString)[128],
+    const EmwAddress::SockAddrIn_t &serverAddress) noexcept
+{
+  static const char (&ca_string)[] = {""};
+  EmwAddress::SockAddrIn_t s_address_in = serverAddress;
+
+  return reinterpret_cast<EmwApiBase::Mtls_t>(this->emw.tlsConnectSni(serverNameString,
+         std::strlen(serverNameString),
+         reinterpret_cast<EmwAddress::SockAddrStorage_t &>(s_address_in), sizeof(s_address_in),
+         reinterpret_cast<const char (&)[2500]>(ca_string), 0));
+}
+
+std::int32_t AppConsoleTlsBench::doHandshakes(const char (&serverNameString)[128],
+    const EmwAddress::SockAddrIn_t &serverAddress, std::uint32_t count) noexcept
+{
+  AppConsoleTlsBench::Timing_t timing;
+
+  (void) std::printf("%s: %" PRIu32 " handshakes ", this->getName(), count);
+  for (std::uint32_t i = 0U; i < count; i++) {
+    const std::uint32_t tstart = HAL_GetTick();
+    const EmwApiBase::Mtls_t tls_magic = this->connect(serverNameString, serverAddress);
+
+    if (nullptr == tls_magic) {
+      (void) std::printf("x\n");
+      return -1;
+    }
+    timing.add(HAL_GetTick() - tstart);
+    (void) this->emw.tlsClose(tls_magic);
+    (void) std::printf(".");
+  }
+  (void) std::printf("\n");
+  this->printTiming("handshake", timing, "ms");
+  return 0;
+}
+
+/* Each message is sent then fully received back, the time of each call is kept apart. */
+std::int32_t AppConsoleTlsBench::doLatency(EmwApiBase::Mtls_t tlsMagic, std::uint32_t count,
+    std::uint32_t messageSize) noexcept
+{
+  AppConsoleTlsBench::Timing_t send_timing;
+  AppConsoleTlsBench::Timing_t receive_timing;
+  AppConsoleTlsBench::Timing_t round_trip_timing;
+
+  (void) std::printf("%s: %" PRIu32 " echoes of %" PRIu32 " bytes ", this->getName(), count, messageSize);
+  for (std::uint32_t i = 0U; i < count; i++) {
+    const std::uint32_t cycles_start = CycleCounter::Get();
+    std::uint32_t cycles_sent;
+
+    if (static_cast<std::int32_t>(messageSize) != this->emw.tlsSendAll(tlsMagic,
+        reinterpret_cast<const std::uint8_t (&)[]>(this->bufferOut), static_cast<std::int32_t>(messageSize))) {
+      (void) std::printf("s\n");
+      return -1;
+    }
+    cycles_sent = CycleCounter::Get();
+    if (0 != this->receiveAll(tlsMagic, messageSize)) {
+      (void) std::printf("x\n");
+      return -1;
+    }
+    {
+      const std::uint32_t cycles_end = CycleCounter::Get();
+
+      send_timing.add(CycleCounter::ToMicroSeconds(cycles_sent - cycles_start));
+      receive_timing.add(CycleCounter::ToMicroSeconds(cycles_end - cycles_sent));
+      round_trip_timing.add(CycleCounter::ToMicroSeconds(cycles_end - cycles_start));
+    }
+    if (0 != std::memcmp(this->bufferIn, this->bufferOut, messageSize)) {
+      (void) std::printf("!\n");
+      return -1;
+    }
+    (void) std::printf(".");
+  }
+  (void) std::printf("\n");
+  this->printTiming("tlsSend", send_timing, "us");
+  this->printTiming("tlsReceive", receive_timing, "us");
+  this->printTiming("round trip", round_trip_timing, "us");
+  return 0;
+}
+
+/* Receives from the source server only, the time counts from the first receive request to the last byte. */
+std::int32_t AppConsoleTlsBench::doDownload(const char (&serverNameString)[128],
+    const EmwAddress::SockAddrIn_t &serverAddress, std::uint32_t totalSize) noexcept
+{
+  std::int32_t status = -1;
+  const EmwApiBase::Mtls_t tls_magic = this->connect(serverNameString, serverAddress);
+
+  (void) std::printf("%s: download %" PRIu32 " bytes ", this->getName(), totalSize);
+  if (nullptr == tls_magic) {
+    (void) std::printf("c\n");
+  }
+  else {
+    std::uint32_t received_size = 0U;
+    const std::uint32_t tstart = HAL_GetTick();
+
+    while (received_size < totalSize) {
+      const std::uint32_t length = ((totalSize - received_size) < AppConsoleTlsBench::BUFFER_SIZE) \
+                                   ? (totalSize - received_size) : AppConsoleTlsBench::BUFFER_SIZE;
+      const std::int32_t count = this->emw.tlsReceive(tls_magic, reinterpret_cast<std::uint8_t (&)[]>(this->bufferIn),
+                                 static_cast<std::int32_t>(length));
+      if (0 >= count) {
+        break;
+      }
+      if (((received_size + static_cast<std::uint32_t>(count)) / (16U * 1024U)) != (received_size / (16U * 1024U))) {
+        (void) std::printf(".");
+      }
+      received_size += static_cast<std::uint32_t>(count);
+    }
+    {
+      const std::uint32_t duration_in_ms = HAL_GetTick() - tstart;
+
+      (void) this->emw.tlsClose(tls_magic);
+      if (received_size < totalSize) {
+        (void) std::printf("x\n");
+      }
+      else {
+        (void) std::printf("\n");
+        this->printBitRate("download", received_size, duration_in_ms);
+        status = 0;
+      }
+    }
+  }
+  return status;
+}
+
+/* Sends to the sink server only, the time counts until the last byte is handed over to the module. */
+std::int32_t AppConsoleTlsBench::doUpload(const char (&serverNameString)[128],
+    const EmwAddress::SockAddrIn_t &serverAddress, std::uint32_t totalSize) noexcept
+{
+  std::int32_t status = -1;
+  const EmwApiBase::Mtls_t tls_magic = this->connect(serverNameString, serverAddress);
+
+  (void) std::printf("%s: upload %" PRIu32 " bytes ", this->getName(), totalSize);
+  if (nullptr == tls_magic) {
+    (void) std::printf("c\n");
+  }
+  else {
+    std::uint32_t sent_size = 0U;
+    const std::uint32_t tstart = HAL_GetTick();
+
+    while (sent_size < totalSize) {
+      const std::uint32_t chunk_size = ((totalSize - sent_size) < AppConsoleTlsBench::BUFFER_SIZE) \
+                                       ? (totalSize - sent_size) : AppConsoleTlsBench::BUFFER_SIZE;
+
+      if (static_cast<std::int32_t>(chunk_size) != this->emw.tlsSendAll(tls_magic,
+          reinterpret_cast<const std::uint8_t (&)[]>(this->bufferOut), static_cast<std::int32_t>(chunk_size))) {
+        break;
+      }
+      sent_size += chunk_size;
+      if (0U == (sent_size % (16U * 1024U))) {
+        (void) std::printf(".");
+      }
+    }
+    {
+      const std::uint32_t duration_in_ms = HAL_GetTick() - tstart;
+
+      (void) this->emw.tlsClose(tls_magic);
+      if (sent_size < totalSize) {
+        (void) std::printf("s\n");
+      }
+      else {
+        (void) std::printf("\n");
+        this->printBitRate("upload", sent_size, duration_in_ms);
+        status = 0;
+      }
+    }
+  }
+  return status;
+}
+
+std::int32_t AppConsoleTlsBench::receiveAll(EmwApiBase::Mtls_t tlsMagic, std::uint32_t length) noexcept
+{
+  std::uint32_t received_size = 0U;
+
+  while (received_size < length) {
+    const std::int32_t count = this->emw.tlsReceive(tlsMagic,
+                               reinterpret_cast<std::uint8_t (&)[]>(this->bufferIn[received_size]),
+                               static_cast<std::int32_t>(length - received_size));
+    if (0 >= count) {
+      return -1;
+    }
+    received_size += static_cast<std::uint32_t>(count);
+  }
+  return 0;
+}
+
+void AppConsoleTlsBench::printBitRate(const char *nameStringPtr, std::uint32_t size,
+                                      std::uint32_t durationInMs) const noexcept
+{
+  if (0U != durationInMs) {
+    (void) std::printf("%s: %-8s %" PRIu32 " bytes in %" PRIu32 " ms, bit rate = %" PRIu32 " Kbit/sec\n",
+                       this->getName(), nameStringPtr, size, durationInMs,
+                       static_cast<std::uint32_t>((static_cast<std::uint64_t>(size) * 8U) / durationInMs));
+  }
+}
+
+void AppConsoleTlsBench::printTiming(const char *nameStringPtr, const AppConsoleTlsBench::Timing_t &timing,
+                                     const char *unitStringPtr) const noexcept
+{
+  if (0U != timing.count) {
+    (void) std::printf("%s: %-10s min %" PRIu32 " %s, avg %" PRIu32 " %s, max %" PRIu32 " %s\n", this->getName(),
+                       nameStringPtr, timing.min, unitStringPtr,
+                       static_cast<std::uint32_t>(timing.sum / timing.count), unitStringPtr, timing.max, unitStringPtr);
+  }
+}
+
+const char AppConsoleTlsBench::SERVER_NAME_STRING[] = {"192.168.1.19"};
+
+static std::uint16_t HostToNetworkShort(std::uint16_t hostShort)
+{
+  return (((static_cast<std::uint16_t>(hostShort) & 0xFF00U) >> 8U) |
+          ((static_cast<std::uint16_t>(hostShort) & 0x00FFU) << 8U));
+}
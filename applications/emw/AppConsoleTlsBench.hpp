@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "Console.hpp"
+#include "EmwAddress.hpp"
+#include "EmwApiBase.hpp"
+
+class EmwApiEmw;
+
+class AppConsoleTlsBench final : public Cmd {
+  public:
+    explicit AppConsoleTlsBench(EmwApiEmw &emw) noexcept;
+  public:
+    virtual ~AppConsoleTlsBench(void) noexcept override;
+  public:
+    std::int32_t execute(std::int32_t argc, char *argvPtrs[]) noexcept override;
+  public:
+    const char *getComment(void) const noexcept override
+    {
+      return "tlsbench [-pPort] [-uPort] [-dPort] [-hHandshakes] [-cCount] [-lSize] [-tKBytes] <host>"
+             " (handshake time and latency against a TLS echo server, throughput against a TLS sink and source)";
+    }
+  public:
+    const char *getName(void) const noexcept override
+    {
+      return "tlsbench";
+    }
+
+  private:
+    typedef struct Timing_s {
+      constexpr Timing_s(void) noexcept
+        : count(0U), min(UINT32_MAX), max(0U), sum(0U) {}
+      void add(std::uint32_t value) noexcept
+      {
+        this->count++;
+        this->min = (value < this->min) ? value : this->min;
+        this->max = (value > this->max) ? value : this->max;
+        this->sum += value;
+      }
+      std::uint32_t count;
+      std::uint32_t min;
+      std::uint32_t max;
+      std::uint64_t sum;
+    } Timing_t;
+
+  private:
+    EmwApiBase::Mtls_t connect(const char (&serverNameString)[128],
+                               const EmwAddress::SockAddrIn_t &serverAddress) noexcept;
+  private:
+    std::int32_t doHandshakes(const char (&serverNameString)[128], const EmwAddress::SockAddrIn_t &serverAddress,
+                              std::uint32_t count) noexcept;
+  private:
+    std::int32_t doLatency(EmwApiBase::Mtls_t tlsMagic, std::uint32_t count, std::uint32_t messageSize) noexcept;
+  private:
+    std::int32_t doDownload(const char (&serverNameString)[128], const EmwAddress::SockAddrIn_t &serverAddress,
+                            std::uint32_t totalSize) noexcept;
+  private:
+    std::int32_t doUpload(const char (&serverNameString)[128], const EmwAddress::SockAddrIn_t &serverAddress,
+                          std::uint32_t totalSize) noexcept;
+  private:
+    std::int32_t receiveAll(EmwApiBase::Mtls_t tlsMagic, std::uint32_t length) noexcept;
+  private:
+    void printBitRate(const char *nameStringPtr, std::uint32_t size, std::uint32_t durationInMs) const noexcept;
+  private:
+    void printTiming(const char *nameStringPtr, const AppConsoleTlsBench::Timing_t &timing,
+                     const char *unitStringPtr) const noexcept;
+
+  private:
+    EmwApiEmw &emw;
+
+  private:
+    static const char SERVER_NAME_STRING[];
+  private:
+    static const std::uint16_t SERVER_PORT = 4433U;
+  private:
+    static const std::uint16_t SINK_SERVER_PORT = 4434U;
+  private:
+    static const std::uint16_t SOURCE_SERVER_PORT = 4435U;
+  private:
+    static const std::uint32_t HANDSHAKE_COUNT = 3U;
+  private:
+    static const std::uint32_t LATENCY_COUNT = 20U;
+  private:
+    static const std::uint32_t LATENCY_SIZE = 64U;
+  private:
+    static const std::uint32_t THROUGHPUT_SIZE_IN_KB = 64U;
+  private:
+    static const std::uint32_t BUFFER_SIZE = 1024U;
+
+  private:
+    std::uint8_t bufferIn[BUFFER_SIZE];
+  private:
+    std::uint8_t bufferOut[BUFFER_SIZE];
+};
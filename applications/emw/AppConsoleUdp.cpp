@@ -0,0 +1,313 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "AppConsoleUdp.hpp"
+#include "EmwApiEmw.hpp"
+#include "EmwOsInterface.hpp"
+#include "stm32u5xx_hal.h"
+#include <cinttypes>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+
+//#define STD_PRINTF(...) (void) std::printf(__VA_ARGS__);
+#define STD_PRINTF(...)
+
+static std::uint16_t HostToNetworkShort(std::uint16_t hostShort);
+
+
+AppConsoleUdp::AppConsoleUdp(EmwApiEmw &emw) noexcept
+  : emw(emw)
+  , bufferIn{0U}
+  , bufferOut{0U}
+{
+  STD_PRINTF("AppConsoleUdp::AppConsoleUdp()>\n")
+  STD_PRINTF("AppConsoleUdp::AppConsoleUdp(): %p\n", static_cast<const void*>(&emw))
+  STD_PRINTF("AppConsoleUdp::AppConsoleUdp()<\n")
+}
+
+AppConsoleUdp::~AppConsoleUdp(void) noexcept
+{
+  STD_PRINTF("AppConsoleUdp::~AppConsoleUdp()>\n")
+  STD_PRINTF("AppConsoleUdp::~AppConsoleUdp()< %p\n", static_cast<const void*>(&emw))
+}
+
+std::int32_t AppConsoleUdp::execute(std::int32_t argc, char *argvPtrs[]) noexcept
+{
+  std::int32_t status = -1;
+  const char *server_name_string_ptr = AppConsoleUdp::REMOTE_IP_ADDRESS_STRING;
+  EmwAddress::SockAddrIn_t s_address_in;
+  EmwAddress::SockAddrIn6_t s_address_in6;
+  std::uint32_t count = AppConsoleUdp::DATAGRAM_COUNT;
+  std::uint32_t datagram_size = AppConsoleUdp::DATAGRAM_SIZE;
+  std::uint32_t interval_in_ms = AppConsoleUdp::DATAGRAM_INTERVAL_MS;
+  bool use_ipv6 = false;
+
+  STD_PRINTF("\nAppConsoleUdp::execute()>\n")
+
+  for (std::int32_t i = 1; i < argc; i++) {
+    if (nullptr != argvPtrs[i]) {
+      if (0 == std::strncmp("-6", argvPtrs[i], 2)) {
+        use_ipv6 = true;
+        server_name_string_ptr = AppConsoleUdp::REMOTE_IP6_ADDRESS_STRING;
+      }
+      else if (0 == std::strncmp("-c", argvPtrs[i], 2)) {
+        count = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else if (0 == std::strncmp("-l", argvPtrs[i], 2)) {
+        datagram_size = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else if (0 == std::strncmp("-i", argvPtrs[i], 2)) {
+        interval_in_ms = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else {
+        server_name_string_ptr = argvPtrs[i];
+      }
+    }
+  }
+  if ((datagram_size < AppConsoleUdp::SEQUENCE_SIZE) || (datagram_size > AppConsoleUdp::DATAGRAM_SIZE_MAX)) {
+    (void) std::printf("%s: datagram size must be in [%" PRIu32 "..%" PRIu32 "]\n", this->getName(),
+                       AppConsoleUdp::SEQUENCE_SIZE, AppConsoleUdp::DATAGRAM_SIZE_MAX);
+    return -1;
+  }
+  if ((0U == count) || (count > AppConsoleUdp::DATAGRAM_COUNT_MAX)) {
+    (void) std::printf("%s: count must be in [1..%" PRIu32 "]\n", this->getName(), AppConsoleUdp::DATAGRAM_COUNT_MAX);
+    return -1;
+  }
+  (void) std::printf("%s: <%s> %" PRIu32 " x %" PRIu32 " bytes every %" PRIu32 " ms\n", this->getName(),
+                     server_name_string_ptr, count, datagram_size, interval_in_ms);
+  try {
+    const std::size_t bitmap_size = (count + 7U) / 8U;
+    std::unique_ptr<std::uint8_t, decltype(&EmwOsInterface::Free)> \
+    received_bitmap_ptr(static_cast<std::uint8_t *>(EmwOsInterface::Malloc(bitmap_size)), &EmwOsInterface::Free);
+    std::int32_t socket = -1;
+
+    if (nullptr == received_bitmap_ptr) {
+      throw std::runtime_error("no memory");
+    }
+    (void) std::memset(received_bitmap_ptr.get(), 0, bitmap_size);
+    if (use_ipv6) {
+      EmwAddress::Ip6Addr_t address;
+
+      EmwAddress::AsciiToNetwork(server_name_string_ptr, address);
+      s_address_in6.port = HostToNetworkShort(AppConsoleUdp::REMOTE_UDP_PORT);
+      s_address_in6.in6Addr.un.u32Addr[0] = address.addr[0];
+      s_address_in6.in6Addr.un.u32Addr[1] = address.addr[1];
+      s_address_in6.in6Addr.un.u32Addr[2] = address.addr[2];
+      s_address_in6.in6Addr.un.u32Addr[3] = address.addr[3];
+      socket = this->emw.socketCreate(EMW_AF_INET6, EMW_SOCK_DGRAM, EMW_IPPROTO_UDP);
+    }
+    else {
+      EmwAddress::IpAddr_t address;
+
+      EmwAddress::AsciiToNetwork(server_name_string_ptr, address);
+      s_address_in.port = HostToNetworkShort(AppConsoleUdp::REMOTE_UDP_PORT);
+      s_address_in.inAddr.addr = address.addr;
+      socket = this->emw.socketCreate(EMW_AF_INET, EMW_SOCK_DGRAM, EMW_IPPROTO_UDP);
+    }
+    if (socket < 0) {
+      throw std::runtime_error("socketCreate() failed");
+    }
+    {
+      const std::int32_t timeout_in_ms = AppConsoleUdp::TIMEOUT_1S_DEFINED;
+
+      if (0 != this->emw.socketSetSockOpt(socket, EMW_SOL_SOCKET, EmwSockOptVal::eEMW_SO_RCVTIMEO,
+                                          &timeout_in_ms, sizeof(timeout_in_ms))) {
+        (void) this->emw.socketClose(socket);
+        throw std::runtime_error("socketSetSockOpt() for receiving failed");
+      }
+    }
+    if (use_ipv6) {
+      status = this->doUdpStream(socket, reinterpret_cast<const EmwAddress::SockAddr_t &>(s_address_in6),
+                                 sizeof(s_address_in6), count, datagram_size, interval_in_ms,
+                                 reinterpret_cast<std::uint8_t (&)[]>(*received_bitmap_ptr.get()));
+    }
+    else {
+      status = this->doUdpStream(socket, reinterpret_cast<const EmwAddress::SockAddr_t &>(s_address_in),
+                                 sizeof(s_address_in), count, datagram_size, interval_in_ms,
+                                 reinterpret_cast<std::uint8_t (&)[]>(*received_bitmap_ptr.get()));
+    }
+    (void) this->emw.socketClose(socket);
+  }
+  catch (const std::runtime_error &error) {
+    (void) std::printf("%s: %s\n", this->getName(), error.what());
+    status = -1;
+  }
+  STD_PRINTF("\nAppConsoleUdp::execute()<\n\n")
+  return status;
+}
+
+/* The datagrams are sent at a fixed pace without waiting for their echo, the echoes are read in between.
+ * The sequence numbers of the echoes give the loss, the duplicates and the datagrams received out of order.
+ * The stream ends when no echo comes within DRAIN_TIMEOUT_MS after the last datagram.
+ */
+std::int32_t AppConsoleUdp::doUdpStream(std::int32_t socket, const EmwAddress::SockAddr_t &toAddress,
+                                        std::int32_t toAddressLength, std::uint32_t count, std::uint32_t datagramSize,
+                                        std::uint32_t intervalInMs, std::uint8_t (&receivedBitmap)[]) noexcept
+{
+  std::uint32_t sequence = 0U;
+  std::uint32_t sent_count = 0U;
+  std::uint32_t received_count = 0U;
+  std::uint32_t duplicated_count = 0U;
+  std::uint32_t reordered_count = 0U;
+  std::uint32_t corrupted_count = 0U;
+  std::uint32_t highest_sequence = 0U;
+  std::uint32_t next_send_in_ms = 0U;
+  std::uint32_t last_activity_in_ms = 0U;
+  std::uint32_t send_duration_in_ms = 0U;
+  std::uint32_t elapsed_in_ms = 0U;
+  const std::uint32_t tstart = HAL_GetTick();
+
+  for (;;) {
+    std::uint32_t wait_in_ms;
+
+    elapsed_in_ms = HAL_GetTick() - tstart;
+    if (sequence < count) {
+      if (elapsed_in_ms >= next_send_in_ms) {
+        this->fillBufferOut(sequence, datagramSize);
+        if (static_cast<std::int32_t>(datagramSize) \
+            == this->emw.socketSendTo(socket, reinterpret_cast<std::uint8_t (&)[]>(* &this->bufferOut[0]),
+                                      static_cast<std::int32_t>(datagramSize), 0, toAddress, toAddressLength)) {
+          sent_count++;
+        }
+        sequence++;
+        next_send_in_ms += intervalInMs;
+        last_activity_in_ms = HAL_GetTick() - tstart;
+        send_duration_in_ms = last_activity_in_ms;
+        continue;
+      }
+      wait_in_ms = next_send_in_ms - elapsed_in_ms;
+    }
+    else if ((elapsed_in_ms - last_activity_in_ms) >= AppConsoleUdp::DRAIN_TIMEOUT_MS) {
+      break;
+    }
+    else {
+      wait_in_ms = AppConsoleUdp::DRAIN_TIMEOUT_MS - (elapsed_in_ms - last_activity_in_ms);
+    }
+    if (this->waitReadable(socket, wait_in_ms)) {
+      EmwAddress::SockAddrIn6_t from_address;
+      std::uint32_t from_address_length = sizeof(from_address);
+      const std::int32_t received = this->emw.socketReceiveFrom(socket,
+                                    reinterpret_cast<std::uint8_t (&)[]>(* &this->bufferIn[0]),
+                                    static_cast<std::int32_t>(sizeof(this->bufferIn)), 0,
+                                    reinterpret_cast<EmwAddress::SockAddr_t &>(from_address), from_address_length);
+
+      if (static_cast<std::int32_t>(AppConsoleUdp::SEQUENCE_SIZE) <= received) {
+        const std::uint32_t echoed_sequence \
+          = this->readSequence(reinterpret_cast<std::uint8_t (&)[]>(* &this->bufferIn[0]));
+
+        last_activity_in_ms = HAL_GetTick() - tstart;
+        if ((echoed_sequence >= sequence) \
+            || !this->isBufferInValid(echoed_sequence, static_cast<std::uint32_t>(received), datagramSize)) {
+          corrupted_count++;
+        }
+        else if (0U != (receivedBitmap[echoed_sequence / 8U] & (1U << (echoed_sequence % 8U)))) {
+          duplicated_count++;
+        }
+        else {
+          receivedBitmap[echoed_sequence / 8U] |= static_cast<std::uint8_t>(1U << (echoed_sequence % 8U));
+          if ((0U < received_count) && (echoed_sequence < highest_sequence)) {
+            reordered_count++;
+          }
+          else {
+            highest_sequence = echoed_sequence;
+          }
+          received_count++;
+        }
+      }
+    }
+  }
+
+  (void) std::printf("%s: sent %" PRIu32 "/%" PRIu32 ", echoed %" PRIu32 ", reordered %" PRIu32 ","
+                     " duplicated %" PRIu32 ", corrupted %" PRIu32 "\n", this->getName(), sent_count, count,
+                     received_count, reordered_count, duplicated_count, corrupted_count);
+  if (0U != sent_count) {
+    const std::uint32_t lost_count = sent_count - received_count;
+
+    (void) std::printf("%s: loss %" PRIu32 ".%02" PRIu32 " %%\n", this->getName(),
+                       (100U * lost_count) / sent_count, ((10000U * lost_count) / sent_count) % 100U);
+  }
+  if (0U != send_duration_in_ms) {
+    (void) std::printf("%s: sent %" PRIu32 " bytes in %" PRIu32 " ms, bit rate = %" PRIu32 " Kbit/sec\n",
+                       this->getName(), sent_count * datagramSize, send_duration_in_ms,
+                       (sent_count * datagramSize * 8U) / send_duration_in_ms);
+  }
+  if (0U != last_activity_in_ms) {
+    (void) std::printf("%s: echoed %" PRIu32 " bytes in %" PRIu32 " ms, bit rate = %" PRIu32 " Kbit/sec\n",
+                       this->getName(), received_count * datagramSize, last_activity_in_ms,
+                       (received_count * datagramSize * 8U) / last_activity_in_ms);
+  }
+  return (0U != received_count) ? 0 : -1;
+}
+
+void AppConsoleUdp::fillBufferOut(std::uint32_t sequence, std::uint32_t datagramSize) noexcept
+{
+  this->bufferOut[0] = static_cast<std::uint8_t>(sequence >> 24);
+  this->bufferOut[1] = static_cast<std::uint8_t>(sequence >> 16);
+  this->bufferOut[2] = static_cast<std::uint8_t>(sequence >> 8);
+  this->bufferOut[3] = static_cast<std::uint8_t>(sequence);
+  for (std::uint32_t i = AppConsoleUdp::SEQUENCE_SIZE; i < datagramSize; i++) {
+    this->bufferOut[i] = static_cast<std::uint8_t>(i + sequence);
+  }
+}
+
+bool AppConsoleUdp::isBufferInValid(std::uint32_t sequence, std::uint32_t length,
+                                    std::uint32_t datagramSize) const noexcept
+{
+  bool is_valid = (length == datagramSize);
+
+  for (std::uint32_t i = AppConsoleUdp::SEQUENCE_SIZE; is_valid && (i < datagramSize); i++) {
+    is_valid = (this->bufferIn[i] == static_cast<std::uint8_t>(i + sequence));
+  }
+  return is_valid;
+}
+
+std::uint32_t AppConsoleUdp::readSequence(const std::uint8_t (&buffer)[]) const noexcept
+{
+  return (static_cast<std::uint32_t>(buffer[0]) << 24) | (static_cast<std::uint32_t>(buffer[1]) << 16) \
+         | (static_cast<std::uint32_t>(buffer[2]) << 8) | static_cast<std::uint32_t>(buffer[3]);
+}
+
+bool AppConsoleUdp::waitReadable(std::int32_t socket, std::uint32_t timeoutInMs) noexcept
+{
+  EmwFdSet_t read_fds;
+  EmwFdSet_t write_fds;
+  EmwFdSet_t except_fds;
+  const EmwTimeVal_t timeout = {
+    static_cast<std::int32_t>(timeoutInMs / 1000U), static_cast<std::int32_t>((timeoutInMs % 1000U) * 1000U)
+  };
+
+  EMW_FD_ZERO(&read_fds);
+  EMW_FD_ZERO(&write_fds);
+  EMW_FD_ZERO(&except_fds);
+  EMW_FD_SET(socket, &read_fds);
+  return (0 < this->emw.socketSelect(socket + 1, &read_fds, &write_fds, &except_fds, timeout)) \
+         && EMW_FD_ISSET(socket, &read_fds);
+}
+
+const char AppConsoleUdp::REMOTE_IP_ADDRESS_STRING[] = {"192.168.1.19"};
+const char AppConsoleUdp::REMOTE_IP6_ADDRESS_STRING[] = {"2001:861:3881:3e70:4998:30e5:9660:843"};
+
+static std::uint16_t HostToNetworkShort(std::uint16_t hostShort)
+{
+  return (((static_cast<std::uint16_t>(hostShort) & 0xFF00U) >> 8U) |
+          ((static_cast<std::uint16_t>(hostShort) & 0x00FFU) << 8U));
+}
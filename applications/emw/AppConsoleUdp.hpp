@@ -0,0 +1,88 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "Console.hpp"
+#include "EmwAddress.hpp"
+
+class EmwApiEmw;
+
+class AppConsoleUdp final : public Cmd {
+  public:
+    explicit AppConsoleUdp(EmwApiEmw &emw) noexcept;
+  public:
+    virtual ~AppConsoleUdp(void) noexcept override;
+  public:
+    std::int32_t execute(std::int32_t argc, char *argvPtrs[]) noexcept override;
+  public:
+    const char *getComment(void) const noexcept override
+    {
+      return "udp [-cCount] [-lSize] [-iIntervalMs] [-6] <ip>"
+             " (paced datagrams to an UDP echo server, reports throughput, loss and reordering)";
+    }
+  public:
+    const char *getName(void) const noexcept override
+    {
+      return "udp";
+    }
+
+  private:
+    std::int32_t doUdpStream(std::int32_t socket, const EmwAddress::SockAddr_t &toAddress,
+                             std::int32_t toAddressLength, std::uint32_t count, std::uint32_t datagramSize,
+                             std::uint32_t intervalInMs, std::uint8_t (&receivedBitmap)[]) noexcept;
+  private:
+    void fillBufferOut(std::uint32_t sequence, std::uint32_t datagramSize) noexcept;
+  private:
+    bool isBufferInValid(std::uint32_t sequence, std::uint32_t length, std::uint32_t datagramSize) const noexcept;
+  private:
+    std::uint32_t readSequence(const std::uint8_t (&buffer)[]) const noexcept;
+  private:
+    bool waitReadable(std::int32_t socket, std::uint32_t timeoutInMs) noexcept;
+
+  private:
+    EmwApiEmw &emw;
+
+  private:
+    static const char REMOTE_IP_ADDRESS_STRING[];
+  private:
+    static const char REMOTE_IP6_ADDRESS_STRING[];
+  private:
+    static const std::uint16_t REMOTE_UDP_PORT = 7U;
+  private:
+    static const std::uint32_t DATAGRAM_COUNT = 100U;
+  private:
+    static const std::uint32_t DATAGRAM_COUNT_MAX = 10000U;
+  private:
+    static const std::uint32_t DATAGRAM_INTERVAL_MS = 10U;
+  private:
+    static const std::uint32_t DATAGRAM_SIZE = 1000U;
+  private:
+    static const std::uint32_t DATAGRAM_SIZE_MAX = 1472U;
+  private:
+    static const std::uint32_t DRAIN_TIMEOUT_MS = 1000U;
+  private:
+    static const std::uint32_t SEQUENCE_SIZE = 4U;
+  private:
+    static const std::int32_t TIMEOUT_1S_DEFINED = 1000;
+
+  private:
+    std::uint8_t bufferIn[DATAGRAM_SIZE_MAX];
+  private:
+    std::uint8_t bufferOut[DATAGRAM_SIZE_MAX];
+};
@@ -0,0 +1,530 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "AppHttpSSE.hpp"
+#include "EmwAddress.hpp"
+#include "EmwApiEmw.hpp"
+#include "FreeRTOS.h"
+#include "portable.h"
+#include "main.hpp"
+#include "task.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cinttypes>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+
+//#define STD_PRINTF(...) std::printf(__VA_ARGS__);
+#define STD_PRINTF(...)
+
+static std::uint16_t HostToNetworkShort(std::uint16_t hostShort);
+
+
+void AppHttpSSE::initializeServer(std::uint32_t ipAddressIn, std::uint16_t port) noexcept
+{
+  AppHttpSSE::serverIpAddrIn = ipAddressIn;
+  AppHttpSSE::serverPort = port;
+  {
+    BaseType_t status = 0;
+    const BaseType_t PASS = 1; /* pdPASS */
+    const char webserver_task_name[] = {"HTTP-Main"};
+    status = xTaskCreate(AppHttpSSE::doListenService, webserver_task_name,
+                         AppHttpSSE::WEBSERVER_TASK_STACK_SIZE, this,
+                         AppHttpSSE::WEBSERVER_TASK_PRIORITY, NULL);
+    if (PASS != status) {
+      ErrorHandler();
+    }
+  }
+}
+
+std::uint32_t AppHttpSSE::convertToOsTicks(uint32_t milliseconds) noexcept
+{
+  return static_cast<std::uint32_t>((static_cast<std::uint64_t>(milliseconds) * static_cast<std::uint64_t>
+                                     (configTICK_RATE_HZ)) / 1000U);
+}
+
+void AppHttpSSE::doAcceptService(void *argPtr) noexcept
+{
+  const AcceptContext_t accept_context = *(static_cast<AcceptContext_t *>(argPtr));
+
+  vPortFree(argPtr);
+  accept_context.appPtr->doAcceptService(accept_context.sock);
+  vTaskDelete(NULL);
+  for (;;);
+}
+
+void AppHttpSSE::doAcceptService(std::int32_t sock) noexcept
+{
+  class AppHttpSSE::Client peer(this->emw, sock);
+  const size_t receive_buffer_length = (1024) * sizeof(char);
+
+  std::setbuf(stdout, nullptr);
+
+  try {
+    std::unique_ptr<char[], decltype(&vPortFree)> \
+    receive_buffer_ptr(static_cast<char *>(pvPortMalloc(receive_buffer_length + 1)), &vPortFree);
+
+    if (nullptr != receive_buffer_ptr) {
+      receive_buffer_ptr[0] = static_cast<char>('\0');
+    }
+    else {
+      throw std::runtime_error("pvPortMalloc() failed");
+    }
+    {
+      EmwAddress::SockAddrIn_t s_name_in;
+      std::uint32_t s_name_in_size = sizeof(s_name_in);
+
+      if (0 == this->emw.socketGetPeerName(peer.sock, reinterpret_cast<EmwAddress::SockAddr_t &>(s_name_in),
+                                           s_name_in_size)) {
+        peer.setInfo(s_name_in.inAddr.addr, s_name_in.port);
+      }
+    }
+    peer.infos();
+    {
+      const std::int32_t count = peer.receiveRequest(receive_buffer_ptr.get(), receive_buffer_length);
+      STD_PRINTF("\n%" PRIi32 " >>> %" PRIi32 " <<<\n", sock, count)
+      if (0 < count) {
+        receive_buffer_ptr[count] = '\0';
+        STD_PRINTF("\n%" PRIi32 " >>>%s<<<\n", sock, receive_buffer_ptr.get())
+      }
+      else {
+        peer.close();
+        peer.infos();
+        std::printf("AppHttpSSE::doAcceptService(): %" PRIi32 "\n", count);
+        throw std::runtime_error("socketReceive() failed");
+      }
+      peer.infos();
+      if (std::strncmp(receive_buffer_ptr.get(), "GET / ", 6) == 0) {
+        peer.sendIndexHtml();
+      }
+      else if (std::strncmp(receive_buffer_ptr.get(), "GET /events ", 12) == 0) {
+        peer.sendEventStream();
+      }
+      else {
+        peer.sendError404Html();
+      }
+      peer.infos();
+      while (AppHttpSSE::Client::eSTATUS_COMM_STREAM == peer.getStatus()) {
+        peer.infos();
+        vTaskDelay(AppHttpSSE::convertToOsTicks(500));
+        {
+          char event_string[1200] = "";
+          AppHttpSSE::listTasks(event_string, sizeof(event_string));
+          peer.sendEvent("threads", event_string);
+        }
+        {
+          vTaskDelay(AppHttpSSE::convertToOsTicks(1000));
+          char event_string[50] = "";
+          AppHttpSSE::listRemainingFreeHeap(event_string, sizeof(event_string));
+          peer.sendEvent("memory", event_string);
+        }
+        if (AppHttpSSE::Client::eSTATUS_COMM_STREAM == peer.getStatus()) {
+          vTaskDelay(AppHttpSSE::convertToOsTicks(500));
+        }
+      }
+    }
+  }
+  catch (const std::runtime_error &error) {
+    std::printf("AppHttpSSE::doAcceptService()< %s\n", error.what());
+    std::printf("AppHttpSSE::doAcceptService()< socket <%" PRIi32 ">\n", sock);
+  }
+  peer.close();
+  STD_PRINTF("AppHttpSSE::doAcceptService()< leaving thread #<%" PRIi32 ">\n", sock)
+}
+
+void AppHttpSSE::doListenService(void) noexcept
+{
+  STD_PRINTF("AppHttpSSE::doListenService()>\n")
+
+  std::setbuf(stdout, nullptr);
+
+  try {
+    std::int32_t sock;
+
+    if ((sock = this->emw.socketCreate(EMW_AF_INET, EMW_SOCK_STREAM, EMW_IPPROTO_TCP)) < 0) {
+      throw std::runtime_error("socketCreate() failed");
+    }
+    {
+      const EmwAddress::SockAddrIn_t s_addr_in(HostToNetworkShort(AppHttpSSE::serverPort), AppHttpSSE::serverIpAddrIn);
+
+      if (0 != this->emw.socketBind(sock, reinterpret_cast<const EmwAddress::SockAddr_t &>(s_addr_in),
+                                    sizeof(s_addr_in))) {
+        throw std::runtime_error("socketBind() failed");
+      }
+    }
+    if (0 != this->emw.socketListen(sock, AppHttpSSE::WEBSERVER_LISTEN_BACKLOG)) {
+      throw std::runtime_error("socketListen() failed");
+    }
+
+    while (true) {
+      EmwAddress::SockAddrIn6_t s_remote_in;
+      std::uint32_t s_remote_in_size = sizeof(s_remote_in);
+
+      /* A blocking accept would keep the IPC channel busy, it is only called once the socket is readable. */
+      if (0 >= this->emw.socketWaitReady(sock, EmwSocketWatcher::eREADABLE, AppHttpSSE::REQUEST_TIMEOUT_MS)) {
+        continue;
+      }
+      const std::int32_t connected_sock = this->emw.socketAccept(sock,
+                                          reinterpret_cast<EmwAddress::SockAddr_t &>(s_remote_in), s_remote_in_size);
+      if (0 > connected_sock) {
+        continue;
+      }
+      STD_PRINTF("\n accepting %" PRIi32 "\n", connected_sock)
+
+      {
+        BaseType_t status = 0;
+        const BaseType_t PASS = 1; /* pdPASS */
+        char task_name[15];
+        const size_t task_name_length = sizeof(task_name);
+        AcceptContext_t *const accept_context_ptr \
+          = static_cast<AcceptContext_t *>(pvPortMalloc(sizeof(AcceptContext_t)));
+
+        if (nullptr == accept_context_ptr) {
+          (void) this->emw.socketClose(connected_sock);
+          throw std::runtime_error("pvPortMalloc() failed");
+        }
+        accept_context_ptr->appPtr = this;
+        accept_context_ptr->sock = connected_sock;
+        std::snprintf(task_name, task_name_length - 1, "HTTP-%04" PRIX32, connected_sock);
+        task_name[task_name_length - 1] = '\0';
+        status = xTaskCreate(AppHttpSSE::doAcceptService, task_name,
+                             AppHttpSSE::WEBSERVER_CHILD_TASK_STACK_SIZE, static_cast<void *>(accept_context_ptr),
+                             AppHttpSSE::WEBSERVER_CHILD_TASK_PRIORITY, NULL);
+        if (PASS != status) {
+          vPortFree(accept_context_ptr);
+          (void) this->emw.socketClose(connected_sock);
+          throw std::runtime_error("xTaskCreate() failed");
+        }
+      }
+    }
+  }
+  catch (const std::runtime_error &error) {
+    std::printf("AppHttpSSE::doListenService()< %s\n", error.what());
+  }
+  vTaskDelete(NULL);
+}
+
+void AppHttpSSE::listTasks(char *bufferStringPtr, std::size_t bufferStringSize) noexcept
+{
+  std::strcat(bufferStringPtr, \
+              "Name                    State  Prio  Stack  Num  \n" \
+              "------------------------------------------------ \n");
+  vTaskListTasks(bufferStringPtr + strlen(bufferStringPtr), bufferStringSize - (2 * std::strlen(bufferStringPtr)));
+  std::strcat(bufferStringPtr, \
+              "------------------------------------------------ \n" \
+              "X:Running B:Blocked R:Ready D:Deleted S:Suspended\n");
+  STD_PRINTF("%" PRIu32 "\n", static_cast<std::uint32_t>(strlen(bufferStringPtr)))
+}
+
+void AppHttpSSE::listRemainingFreeHeap(char *bufferStringPtr, std::size_t bufferStringSize) noexcept
+{
+  char free_heap[26];
+  const std::size_t free_heap_size = sizeof(free_heap) - 1;
+  std::snprintf(free_heap, free_heap_size, "Remaining heap: %08d", xPortGetFreeHeapSize());
+  free_heap[free_heap_size] = '\0';
+  std::strncat(bufferStringPtr, free_heap, bufferStringSize - 1);
+  bufferStringPtr[bufferStringSize - 1] = '\0';
+}
+
+char *AppHttpSSE::chop(char *stringPtr) noexcept
+{
+  char *char_ptr = stringPtr;
+  char_ptr += std::strlen(stringPtr) - 1;
+  while ((char_ptr != stringPtr) && ((*char_ptr == '\n') || (*char_ptr == '\r'))) {
+    *char_ptr = '\0';
+    --char_ptr;
+  }
+  return stringPtr;
+}
+
+int32_t AppHttpSSE::encodeHttpEvent(char *outBufferPtr, std::size_t outBufferLength, const char *eventNamePtr,
+                                    char *messagePtr) noexcept
+{
+  static unsigned long id_counter = 0U;
+
+  char *char_write_ptr = outBufferPtr;
+  std::uint32_t char_write_left_count = static_cast<uint32_t>(outBufferLength - 1);
+  std::uint32_t written;
+  std::uint32_t chunked_size;
+  char *chunked_size_ptr;
+  written = std::snprintf(char_write_ptr, char_write_left_count,
+                          "Content-Type:text/event-stream;charset=utf8\r\n" \
+                          "Transfer-Encoding: chunked\r\n" \
+                          "xxx\r\n" \
+                          "event:%s\n" \
+                          "id:%12lu\n",
+                          eventNamePtr, id_counter++);
+  char_write_left_count -= written;
+  char_write_ptr += written;
+  chunked_size_ptr \
+    = outBufferPtr + std::strlen("Content-Type:text/event-stream;charset=utf8\r\nTransfer-Encoding:chunked\r\n");
+  chunked_size = std::strlen("events:") + std::strlen(eventNamePtr) + 1;
+  chunked_size += std::strlen("id:") + 12 + 1;
+
+  {
+    char *tokenize_worker_ptr = nullptr;
+    char *line_ptr;
+
+    AppHttpSSE::chop(messagePtr);
+    line_ptr = AppHttpSSE::tokenize(messagePtr, "\n", tokenize_worker_ptr);
+
+    while (nullptr != line_ptr) {
+      AppHttpSSE::chop(line_ptr);
+      STD_PRINTF("*** %s\n", line_ptr)
+      written = std::snprintf(char_write_ptr, char_write_left_count, "data:%s\n", line_ptr); /* "<br>\n" */
+      char_write_left_count -= written;
+      char_write_ptr += written;
+      chunked_size += written;
+      line_ptr = AppHttpSSE::tokenize(nullptr, "\n", tokenize_worker_ptr);
+    }
+    written = std::snprintf(char_write_ptr, char_write_left_count, "%s", "\n\n\r\n");
+    chunked_size += written;
+    {
+      char chunked_size_string[] = {"ssss"};
+      std::snprintf(chunked_size_string, 4, "%3" PRIx32 "", chunked_size);
+      std::memcpy(chunked_size_ptr, chunked_size_string, 3);
+    }
+  }
+  outBufferPtr[outBufferLength - 1] = '\0';
+  return 0;
+}
+
+char *AppHttpSSE::tokenize(char *stringPtr, const char *delimiterString, char * &context) noexcept
+{
+  char *token_begin_ptr;
+
+  if (nullptr != stringPtr) {
+    context = stringPtr;
+  }
+  context += std::strspn(context, delimiterString);
+  if ('\0' == *context) {
+    return nullptr;
+  }
+
+  {
+    token_begin_ptr = context;
+    context += std::strcspn(context, delimiterString);
+    if ('\0' != *context) {
+      *context++ = '\0';
+    }
+  }
+  return token_begin_ptr;
+}
+
+AppHttpSSE::Client::ClientStatus AppHttpSSE::Client::getStatus(void) noexcept
+{
+  return this->status;
+}
+
+std::int32_t AppHttpSSE::Client::receiveRequest(char *bufferPtr, std::size_t bufferSize) noexcept
+{
+  std::int32_t count = -1;
+
+  /* As for accept, the receive is only called once the request is there to not monopolize the IPC channel. */
+  if (0 < this->emw.socketWaitReady(this->sock, EmwSocketWatcher::eREADABLE, AppHttpSSE::REQUEST_TIMEOUT_MS)) {
+    count = this->emw.socketReceive(this->sock, reinterpret_cast<std::uint8_t (&)[]>(*bufferPtr),
+                                    static_cast<std::int32_t>(bufferSize), 0);
+  }
+  return count;
+}
+
+std::int32_t AppHttpSSE::Client::sendEvent(const char *eventNamePtr, char *bufferStringPtr) noexcept
+{
+  if (std::strlen(bufferStringPtr) == 0) {
+    return 1;
+  }
+  if (this->status == AppHttpSSE::Client::eSTATUS_COMM_STREAM) {
+    char send_outbuffer[1200];
+
+    this->message++;
+    STD_PRINTF(" ->Send to %s <%" PRIi32 ">\n", this->info, this->sock)
+    AppHttpSSE::encodeHttpEvent(send_outbuffer, sizeof(send_outbuffer), eventNamePtr, bufferStringPtr);
+
+    if (this->send(send_outbuffer, strlen(send_outbuffer))) {
+      if (this->err) {
+        STD_PRINTF("Close client which signed error at send:\n")
+        this->close();
+      }
+    }
+  }
+  return 0;
+}
+
+std::int32_t AppHttpSSE::Client::send(const char *bufferPtr, std::size_t bufferSize) noexcept
+{
+  STD_PRINTF("[%" PRIi32 "] *****%s*****\n", this->sock, bufferPtr)
+
+  if (this->err) {
+    return 1;
+  }
+  if (static_cast<std::int32_t>(bufferSize) != this->emw.socketSendAll(this->sock,
+      reinterpret_cast<const std::uint8_t (&)[]>(*bufferPtr), static_cast<std::int32_t>(bufferSize), 0)) {
+    this->err = 1;
+    STD_PRINTF("[%" PRIi32 "] ***** ERROR *****\n", this->sock)
+    return 1;
+  }
+  return 0;
+}
+
+void AppHttpSSE::Client::setInfo(std::uint32_t address, std::uint16_t port) noexcept
+{
+  const std::uint8_t peer_addr[4] = {
+    static_cast<std::uint8_t>(address), static_cast<std::uint8_t>(address >> 8),
+    static_cast<std::uint8_t>(address >> 16), static_cast<std::uint8_t>(address >> 24)
+  };
+  const std::uint16_t peer_port = HostToNetworkShort(port);
+
+  std::snprintf(this->info, sizeof(this->info) - 1,
+                "%02" PRIu32 ".%02" PRIu32 ".%02" PRIu32 ".%02" PRIu32 ":%5" PRIu32 "",
+                static_cast<std::uint32_t>(peer_addr[0]), static_cast<std::uint32_t>(peer_addr[1]),
+                static_cast<std::uint32_t>(peer_addr[2]), static_cast<std::uint32_t>(peer_addr[3]),
+                static_cast<std::uint32_t>(peer_port));
+  this->info[sizeof(this->info) - 1] = '\0';
+}
+
+void AppHttpSSE::Client::infos() const noexcept
+{
+#if defined(ENABLE_DEBUG)
+  static const char *client_status_strings[5] = { "UNK", "NEW", "COMM", "SSE", "END" };
+  std::printf("#<%" PRIi32 "> info: %s S: %s Err: %d Messages: %" PRIi32 "\n",
+              this->sock, this->info, client_status_strings[this->status],
+              this->err, this->message);
+#endif /* ENABLE_DEBUG */
+}
+
+void AppHttpSSE::Client::close(void) noexcept
+{
+  STD_PRINTF("!!! Closed connection <%" PRIi32 "> !!!\n", this->sock)
+  if (0 <= this->sock) {
+    static_cast<void>(this->emw.socketShutDown(this->sock, 2));
+    static_cast<void>(this->emw.socketClose(this->sock));
+    this->sock = -1;
+  }
+  this->status = AppHttpSSE::Client::eSTATUS_END;
+}
+
+void AppHttpSSE::Client::sendIndexHtml(void) noexcept
+{
+  static const char response_index_html_body[] = {
+    "<!DOCTYPE HTML>"
+    "<html>"
+    "<head>"
+    "<title>Web Server</title>"
+    "<meta name=\"viewport\" content=\"width=device-width,initial-scale=1\">"
+    "</head>"
+    "<style>"
+    "html{font-family:Verdana;display:inline-block;text-align:left;}"
+    "p{font-size:0.8rem;}"
+    "body{margin:5;}"
+    ".topnav{overflow:hidden;background-color:#3db836;color:white;font-size:0.9rem;}"
+    ".content{padding:16px;}"
+    ".threads{background-color:white;box-shadow:2px 2px 12px 1px rgba(80,80,80,.5);font-family:Courier;}"
+    ".memory{background-color:white;box-shadow:2px 2px 12px 1px rgba(80,80,80,.5);font-family:Courier;}"
+    ".freertos_systems{margin:0 auto;display:grid;grid-gap:1rem;grid-template-rows:repeat(auto-fit,minmax(225px,1fr));}"
+    ".reading{font-size:0.5rem;text-align:left;white-space:pre;}"
+    ".footer{font-style:italic;font-size:0.3rem;text-align:left;position:relative;bottom:0;}"
+    "</style>"
+    "<body>"
+    "<div class=\"topnav\">"
+    "<h2>WEB SERVER (SSE, EMW)</h2>"
+    "</div>"
+    "<div class=\"content\">"
+    "<div class=\"freertos_systems\">"
+    "<div class=\"threads\">"
+    "<p>THREADS</p>"
+    "<p><span class=\"reading\"><span id=\"threads\">%TREADS%</span></span></p>"
+    "</div>"
+    "<div class=\"memory\">"
+    "<p>MEMORY</p>"
+    "<p><span class=\"reading\"><span id=\"memory\">%MEMORY%</span></span></p>"
+    "</div>"
+    "</div>"
+    "</div>"
+    "<div class=\"footer\"><p>Cyril FENARD, 2025</p></div>"
+    "<script>"
+    "if(!!window.EventSource){"
+    "var source=new EventSource('/events');"
+    "source.addEventListener('threads',function(e){"
+    "document.getElementById(\"threads\").innerHTML=e.data;"
+    "},false);"
+    "source.addEventListener('memory',function(e){"
+    "document.getElementById(\"memory\").innerHTML=e.data;"
+    "},false);"
+    "}"
+    "</script>"
+    "</body>"
+    "</html>"
+  };
+  char response_index_html_header[300];
+
+  std::snprintf(response_index_html_header, sizeof(response_index_html_header),
+                "HTTP/1.1 200 OK\r\n"
+                "Server:B-U585I-IOT02A_EMW\r\n"
+                "Access-Control-Allow-Origin:*\r\n"
+                "Access-Control-Allow-Methods:GET\r\n"
+                "Cache-Control:no-cache\r\n"
+                "Connection:close\r\n"
+                "Content-Length:%" PRIu32 "\r\n"
+                "Content-Type:text/html;charset=utf8\r\n\r\n",
+                static_cast<std::uint32_t>(sizeof(response_index_html_body) - 1U));
+  if (this->send(response_index_html_header, std::strlen(response_index_html_header))
+      || this->send(response_index_html_body, sizeof(response_index_html_body) - 1U)) {
+    this->status = AppHttpSSE::Client::eSTATUS_END;
+  }
+}
+
+void AppHttpSSE::Client::sendEventStream(void) noexcept
+{
+  static const char response_event_stream[] = {
+    "HTTP/1.1 200 OK\r\n"
+    "Server:B-U585I-IOT02A_EMW\r\n"
+    "Access-Control-Allow-Origin:*\r\n"
+    "Access-Control-Allow-Methods:GET\r\n"
+    "Cache-Control:no-cache\r\n"
+    "Connection:Keep-Alive\r\n"
+    "Content-Type:text/event-stream\r\n\r\n"
+  };
+
+  if (0 == this->send(response_event_stream, strlen(response_event_stream))) {
+    this->status = AppHttpSSE::Client::eSTATUS_COMM_STREAM;
+  }
+}
+
+void AppHttpSSE::Client::sendError404Html(void) noexcept
+{
+  static const char response_error_404_html[] = {
+    "HTTP/1.1 404\r\n"
+    "Server:B-U585I-IOT02A_EMW\r\n"
+    "Connection:close\r\n"
+    "Content-Length:0\r\n\r\n"
+  };
+  this->send(response_error_404_html, sizeof(response_error_404_html) - 1U);
+  this->status = AppHttpSSE::Client::eSTATUS_END;
+}
+
+std::uint32_t AppHttpSSE::serverIpAddrIn = 0U;
+std::uint16_t AppHttpSSE::serverPort = 0U;
+
+static std::uint16_t HostToNetworkShort(std::uint16_t hostShort)
+{
+  return (((static_cast<std::uint16_t>(hostShort) & 0xFF00U) >> 8U) |
+          ((static_cast<std::uint16_t>(hostShort) & 0x00FFU) << 8U));
+}
@@ -18,11 +18,17 @@
   */
 #include "AppWiFiEmw.hpp"
 #include "AppConsoleEcho.hpp"
+#include "AppConsoleIoBench.hpp"
 #include "AppConsolePing.hpp"
 #include "AppConsoleScan.hpp"
 #include "AppConsoleStats.hpp"
 #include "AppConsoleDownload.hpp"
 #include "AppConsoleTls.hpp"
+#include "AppConsoleTlsBench.hpp"
+#include "AppConsoleUdp.hpp"
+#if defined(COMPILATION_WITH_FREERTOS)
+#include "AppHttpSSE.hpp"
+#endif /* COMPILATION_WITH_FREERTOS */
 #include "EmwAddress.hpp"
 #include "EmwApiEmw.hpp"
 #include "emw_conf.hpp"
@@ -31,7 +37,6 @@
 #include <cinttypes>
 #include <cstdio>
 #include <cstring>
-#include <memory>
 
 //#define STD_PRINTF(...) (void) std::printf(__VA_ARGS__);
 #define STD_PRINTF(...)
@@ -114,8 +119,6 @@ extern "C" {
                          ip_address_bytes[2], ip_address_bytes[3]);
     }
     (void) std::printf("\n connected: %s\n", the_application.emw.isConnected() == 1U ? "true" : "false");
-    the_application.checkIoSpeed();
-
     {
       static const char ssid[33] = {"MyHotSpot"};
       static const char psk[65] = {""};
@@ -133,6 +136,19 @@ extern "C" {
     }
 
     {
+#if defined(COMPILATION_WITH_FREERTOS)
+      class AppHttpSSE sse(the_application.emw);
+      {
+        std::uint8_t ip_address_bytes[4] = {0U, 0U, 0U, 0U};
+
+        the_application.emw.getIPAddress(ip_address_bytes, EmwApiBase::eSOFTAP);
+        sse.initializeServer(static_cast<std::uint32_t>(ip_address_bytes[0])
+                             | (static_cast<std::uint32_t>(ip_address_bytes[1]) << 8)
+                             | (static_cast<std::uint32_t>(ip_address_bytes[2]) << 16)
+                             | (static_cast<std::uint32_t>(ip_address_bytes[3]) << 24), 80);
+        (void) std::printf("\nSSE Web server started (SOFTAP)\n");
+      }
+#endif /* COMPILATION_WITH_FREERTOS */
       {
         static const char ssid[33] = {WIFI_SSID};
         static const char psk[65] = {WIFI_PASSWORD};
@@ -144,11 +160,14 @@ extern "C" {
       {
         class AppConsoleEcho echo(the_application.emw);
         class AppConsoleDownload http(the_application.emw);
+        class AppConsoleIoBench iobench(the_application.emw);
         class AppConsolePing ping(the_application.emw);
         class AppConsoleScan scan(the_application.emw);
         class AppConsoleStats stats(the_application.emw);
         class AppConsoleTls tls(the_application.emw);
-        class Cmd *cmds[] = {&echo, &http, &ping, &scan, &stats, &tls, nullptr};
+        class AppConsoleTlsBench tlsbench(the_application.emw);
+        class AppConsoleUdp udp(the_application.emw);
+        class Cmd *cmds[] = {&echo, &http, &iobench, &ping, &scan, &stats, &tls, &tlsbench, &udp, nullptr};
         class Console the_console("app>", cmds);
 
         the_console.run();
@@ -170,46 +189,6 @@ extern "C" {
   }
 }
 
-void AppWiFiEmw::checkIoSpeed(void) noexcept
-{
-  constexpr std::uint16_t ipc_test_data_size = 2500U /*EmwNetworkStack::NETWORK_BUFFER_SIZE*/;
-  std::unique_ptr<std::uint8_t[]> ipc_test_data_ptr(new std::uint8_t[ipc_test_data_size]);
-
-  if (nullptr != ipc_test_data_ptr) {
-    std::uint32_t send_count = 0U;
-    std::uint32_t receive_count = 0U;
-    std::uint32_t time_ms_count;
-
-    std::memset(&ipc_test_data_ptr[0], 0x00, ipc_test_data_size);
-
-    (void) std::printf("\nAppWiFiEmw::checkIoSpeed()> (80 x (%" PRIu32 " + %" PRIu32 ")) ...\n",
-                       static_cast<std::uint32_t>(ipc_test_data_size), static_cast<std::uint32_t>(ipc_test_data_size));
-
-    time_ms_count = HAL_GetTick();
-    for (std::uint32_t i = 0U; i < 80U; i++) {
-      std::uint16_t echoed_length = ipc_test_data_size;
-      const EmwApiBase::Status status \
-        = this->emw.testIpcEcho(reinterpret_cast<std::uint8_t (&)[]>(* &ipc_test_data_ptr[0]), ipc_test_data_size,
-                                reinterpret_cast<std::uint8_t (&)[]>(* &ipc_test_data_ptr[0]), echoed_length, 5000U);
-      if (EmwApiBase::eEMW_STATUS_OK != status) {
-        (void) std::printf("Failed to call testIpcEcho() (%" PRId32 ")\n", static_cast<std::int32_t>(status));
-        return;
-      }
-      else {
-        send_count += ipc_test_data_size;
-        receive_count += echoed_length;
-      }
-    }
-    time_ms_count = HAL_GetTick() - time_ms_count;
-    if (0 != time_ms_count) {
-      const std::uint32_t total_sent_and_received = send_count + receive_count;
-      const std::uint32_t speed = (8 * total_sent_and_received) / time_ms_count;
-      (void) std::printf("transferred: %" PRIu32 " bytes, time: %" PRIu32 " ms, Speed: %" PRIu32 " Kbps\n",
-                         total_sent_and_received, time_ms_count, speed);
-    }
-  }
-}
-
 void AppWiFiEmw::connectToAp(const char (&ssidString)[33], const char (&passwordString)[65]) noexcept
 {
   EmwApiBase::Status status;
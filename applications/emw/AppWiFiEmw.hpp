@@ -25,8 +25,6 @@ class AppWiFiEmw final {
     AppWiFiEmw(void) noexcept;
   public:
     ~AppWiFiEmw(void) noexcept;
-  public:
-    void checkIoSpeed(void) noexcept;
   public:
     void connectToAp(const char (&ssidString)[33], const char (&passwordString)[65]) noexcept;
   public:
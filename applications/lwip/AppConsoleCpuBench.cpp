@@ -0,0 +1,443 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "AppConsoleCpuBench.hpp"
+#include "CycleCounter.hpp"
+#include "LwipChecksum.hpp"
+#include "memcopy.h"
+#include "stm32u5xx_hal.h"
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+//#define STD_PRINTF(...) (void) std::printf(__VA_ARGS__);
+#define STD_PRINTF(...)
+
+
+AppConsoleCpuBench::AppConsoleCpuBench(void) noexcept
+{
+  STD_PRINTF("AppConsoleCpuBench::AppConsoleCpuBench()>\n")
+  STD_PRINTF("AppConsoleCpuBench::AppConsoleCpuBench()<\n")
+}
+
+AppConsoleCpuBench::~AppConsoleCpuBench(void) noexcept
+{
+  STD_PRINTF("AppConsoleCpuBench::~AppConsoleCpuBench()>\n")
+  STD_PRINTF("AppConsoleCpuBench::~AppConsoleCpuBench()<\n")
+}
+
+std::int32_t AppConsoleCpuBench::execute(std::int32_t argc, char *argvPtrs[]) noexcept
+{
+  std::int32_t status = 0;
+  std::uint32_t tests = 0U;
+  std::uint32_t iterations = AppConsoleCpuBench::ITERATIONS;
+
+  STD_PRINTF("\nAppConsoleCpuBench::execute()>\n")
+
+  for (std::int32_t i = 1; i < argc; i++) {
+    if (nullptr != argvPtrs[i]) {
+      if (0 == std::strcmp("-tchksum", argvPtrs[i])) {
+        tests |= AppConsoleCpuBench::eTEST_CHECKSUM;
+      }
+      else if (0 == std::strcmp("-tmemcpy", argvPtrs[i])) {
+        tests |= AppConsoleCpuBench::eTEST_MEMORY_COPY;
+      }
+      else if (0 == std::strcmp("-tdma", argvPtrs[i])) {
+        tests |= AppConsoleCpuBench::eTEST_DMA_COPY;
+      }
+      else if (0 == std::strcmp("-tring", argvPtrs[i])) {
+        tests |= AppConsoleCpuBench::eTEST_RING;
+      }
+      else if (0 == std::strncmp("-n", argvPtrs[i], 2)) {
+        iterations = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else {
+        (void) std::printf("%s: error with bad argument \"%s\"!\n", this->getName(), argvPtrs[i]);
+        return -1;
+      }
+    }
+  }
+  if (0U == tests) {
+    tests = AppConsoleCpuBench::eTEST_CHECKSUM | AppConsoleCpuBench::eTEST_MEMORY_COPY \
+            | AppConsoleCpuBench::eTEST_DMA_COPY | AppConsoleCpuBench::eTEST_RING;
+  }
+  if (0U == iterations) {
+    iterations = 1U;
+  }
+  {
+    std::unique_ptr<std::uint8_t, decltype(&EmwOsInterface::Free)> \
+    buffer_ptr(static_cast<std::uint8_t *>(EmwOsInterface::Malloc(AppConsoleCpuBench::BUFFER_SIZE + 4U)),
+               &EmwOsInterface::Free);
+    std::unique_ptr<std::uint8_t, decltype(&EmwOsInterface::Free)> \
+    copy_ptr(static_cast<std::uint8_t *>(EmwOsInterface::Malloc(AppConsoleCpuBench::BUFFER_SIZE + 4U)),
+             &EmwOsInterface::Free);
+
+    if ((nullptr == buffer_ptr) || (nullptr == copy_ptr)) {
+      (void) std::printf("%s: no memory\n", this->getName());
+      return -1;
+    }
+    CycleCounter::Start();
+    if (0U != (tests & AppConsoleCpuBench::eTEST_CHECKSUM)) {
+      status = this->doChecksum(iterations, reinterpret_cast<std::uint8_t (&)[]>(*buffer_ptr.get()));
+    }
+    if ((0 == status) && (0U != (tests & AppConsoleCpuBench::eTEST_MEMORY_COPY))) {
+      status = this->doMemoryCopy(iterations, reinterpret_cast<std::uint8_t (&)[]>(*buffer_ptr.get()),
+                                  reinterpret_cast<std::uint8_t (&)[]>(*copy_ptr.get()));
+    }
+    if ((0 == status) && (0U != (tests & AppConsoleCpuBench::eTEST_DMA_COPY))) {
+      status = this->doDmaCopy(iterations, reinterpret_cast<std::uint8_t (&)[]>(*buffer_ptr.get()),
+                               reinterpret_cast<std::uint8_t (&)[]>(*copy_ptr.get()));
+    }
+    if ((0 == status) && (0U != (tests & AppConsoleCpuBench::eTEST_RING))) {
+      status = this->doRing(iterations);
+    }
+  }
+  STD_PRINTF("\nAppConsoleCpuBench::execute()<\n\n")
+  return status;
+}
+
+/* Random lengths, alignments and contents, plus the all ones case that carries the most.
+ * Each checksum is compared with the portable reference and with lwip_standard_chksum() of the stack.
+ * The cycles are the lowest of the iterations, so that the interrupts and the other threads are left out.
+ */
+std::int32_t AppConsoleCpuBench::doChecksum(std::uint32_t iterations, std::uint8_t (&buffer)[]) noexcept
+{
+  std::uint32_t random_state = HAL_GetTick() | 1U;
+  std::uint32_t errors = 0U;
+
+  for (std::uint32_t i = 0U; i < AppConsoleCpuBench::CHECK_COUNT; i++) {
+    const std::uint32_t offset = AppConsoleCpuBench::NextRandom(random_state) % 4U;
+    const std::uint32_t length = AppConsoleCpuBench::NextRandom(random_state) \
+                                 % (AppConsoleCpuBench::BUFFER_SIZE + 1U);
+    const bool is_all_ones = (0U == (i % 16U));
+
+    for (std::uint32_t j = 0U; j < length; j++) {
+      buffer[offset + j] = is_all_ones \
+                           ? 0xFFU : static_cast<std::uint8_t>(AppConsoleCpuBench::NextRandom(random_state));
+    }
+    {
+      const std::uint16_t checksum = LwipChecksum(&buffer[offset], static_cast<int>(length));
+      const std::uint16_t expected = LwipChecksumReference(&buffer[offset], static_cast<int>(length));
+      const std::uint16_t standard = lwip_standard_chksum(&buffer[offset], static_cast<int>(length));
+
+      if ((checksum != expected) || (checksum != standard)) {
+        if (0U == errors) {
+          (void) std::printf("%s: chksum error at offset %" PRIu32 ", length %" PRIu32 ": 0x%04" PRIx32
+                             " instead of 0x%04" PRIx32 " (reference) and 0x%04" PRIx32 " (lwIP)\n",
+                             this->getName(), offset, length, static_cast<std::uint32_t>(checksum),
+                             static_cast<std::uint32_t>(expected), static_cast<std::uint32_t>(standard));
+        }
+        errors++;
+      }
+    }
+  }
+  (void) std::printf("chksum: %" PRIu32 " checks, %" PRIu32 " errors\n", AppConsoleCpuBench::CHECK_COUNT, errors);
+
+  (void) std::printf("test,size,align,cycles,ref_cycles,cycles_per_byte,ref_cycles_per_byte\n");
+  for (std::uint32_t i = 0U; 0U != AppConsoleCpuBench::SIZES[i]; i++) {
+    const std::uint32_t size = AppConsoleCpuBench::SIZES[i];
+
+    for (std::uint32_t offset = 0U; offset < 4U; offset++) {
+      std::uint32_t cycles = UINT32_MAX;
+      std::uint32_t ref_cycles = UINT32_MAX;
+      volatile std::uint16_t checksum;
+
+      for (std::uint32_t j = 0U; j < iterations; j++) {
+        std::uint32_t cycles_start = CycleCounter::Get();
+        std::uint32_t elapsed;
+
+        checksum = LwipChecksum(&buffer[offset], static_cast<int>(size));
+        elapsed = CycleCounter::Get() - cycles_start;
+        cycles = (elapsed < cycles) ? elapsed : cycles;
+
+        cycles_start = CycleCounter::Get();
+        checksum = LwipChecksumReference(&buffer[offset], static_cast<int>(size));
+        elapsed = CycleCounter::Get() - cycles_start;
+        ref_cycles = (elapsed < ref_cycles) ? elapsed : ref_cycles;
+      }
+      (void) checksum;
+      (void) std::printf("chksum,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",", size, offset, cycles, ref_cycles);
+      AppConsoleCpuBench::PrintCyclesPerByte(cycles, size, ",");
+      AppConsoleCpuBench::PrintCyclesPerByte(ref_cycles, size, "\n");
+    }
+  }
+  return (0U == errors) ? 0 : -1;
+}
+
+/* The reference is memcpy() of the C library. The random checks also cover the lengths under 16 bytes
+ * and the bytes around the destination, that must not be written.
+ */
+std::int32_t AppConsoleCpuBench::doMemoryCopy(std::uint32_t iterations, std::uint8_t (&buffer)[],
+    std::uint8_t (&copy)[]) noexcept
+{
+  std::uint32_t random_state = HAL_GetTick() | 1U;
+  std::uint32_t errors = 0U;
+
+  for (std::uint32_t i = 0U; i < AppConsoleCpuBench::BUFFER_SIZE; i++) {
+    buffer[i] = static_cast<std::uint8_t>(AppConsoleCpuBench::NextRandom(random_state));
+  }
+  for (std::uint32_t i = 0U; i < AppConsoleCpuBench::CHECK_COUNT; i++) {
+    const std::uint32_t source_offset = AppConsoleCpuBench::NextRandom(random_state) % 4U;
+    const std::uint32_t destination_offset = AppConsoleCpuBench::NextRandom(random_state) % 4U;
+    const std::uint32_t length = AppConsoleCpuBench::NextRandom(random_state) \
+                                 % (((0U == (i % 4U)) ? 16U : AppConsoleCpuBench::BUFFER_SIZE) - 3U);
+
+    (void) std::memset(&copy[0], 0x5A, AppConsoleCpuBench::BUFFER_SIZE + 4U);
+    (void) MemoryCopy(&copy[destination_offset], &buffer[source_offset], length);
+    if ((0 != std::memcmp(&copy[destination_offset], &buffer[source_offset], length)) \
+        || ((0U < destination_offset) && (0x5AU != copy[destination_offset - 1U])) \
+        || (0x5AU != copy[destination_offset + length])) {
+      if (0U == errors) {
+        (void) std::printf("%s: memcpy error at offsets %" PRIu32 "/%" PRIu32 ", length %" PRIu32 "\n",
+                           this->getName(), source_offset, destination_offset, length);
+      }
+      errors++;
+    }
+  }
+  (void) std::printf("memcpy: %" PRIu32 " checks, %" PRIu32 " errors\n", AppConsoleCpuBench::CHECK_COUNT, errors);
+
+  (void) std::printf("test,size,src_align,dst_align,cycles,ref_cycles,cycles_per_byte,ref_cycles_per_byte\n");
+  for (std::uint32_t i = 0U; 0U != AppConsoleCpuBench::COPY_SIZES[i]; i++) {
+    const std::uint32_t size = AppConsoleCpuBench::COPY_SIZES[i];
+
+    for (std::uint32_t alignments = 0U; alignments < 16U; alignments++) {
+      const std::uint32_t source_offset = alignments / 4U;
+      const std::uint32_t destination_offset = alignments % 4U;
+      std::uint32_t cycles = UINT32_MAX;
+      std::uint32_t ref_cycles = UINT32_MAX;
+
+      for (std::uint32_t j = 0U; j < iterations; j++) {
+        std::uint32_t cycles_start = CycleCounter::Get();
+        std::uint32_t elapsed;
+
+        (void) MemoryCopy(&copy[destination_offset], &buffer[source_offset], size);
+        elapsed = CycleCounter::Get() - cycles_start;
+        cycles = (elapsed < cycles) ? elapsed : cycles;
+
+        cycles_start = CycleCounter::Get();
+        (void) std::memcpy(&copy[destination_offset], &buffer[source_offset], size);
+        elapsed = CycleCounter::Get() - cycles_start;
+        ref_cycles = (elapsed < ref_cycles) ? elapsed : ref_cycles;
+      }
+      (void) std::printf("memcpy,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",",
+                         size, source_offset, destination_offset, cycles, ref_cycles);
+      AppConsoleCpuBench::PrintCyclesPerByte(cycles, size, ",");
+      AppConsoleCpuBench::PrintCyclesPerByte(ref_cycles, size, "\n");
+    }
+  }
+  return (0U == errors) ? 0 : -1;
+}
+
+/* The CPU is only busy for the start of the copy, then it waits here for the end of the GPDMA transfer.
+ * The sizes below MEMORY_COPY_DMA_THRESHOLD are copied by the CPU in MemoryCopyAsync().
+ */
+std::int32_t AppConsoleCpuBench::doDmaCopy(std::uint32_t iterations, std::uint8_t (&buffer)[],
+    std::uint8_t (&copy)[]) noexcept
+{
+  std::int32_t status = 0;
+
+  (void) std::printf("test,size,src_align,dst_align,start_cycles,done_cycles,cycles_per_byte,on_dma\n");
+  for (std::uint32_t i = 0U; (0 == status) && (0U != AppConsoleCpuBench::COPY_SIZES[i]); i++) {
+    const std::uint32_t size = AppConsoleCpuBench::COPY_SIZES[i];
+
+    for (std::uint32_t offset = 0U; offset < 2U; offset++) {
+      std::uint32_t start_cycles = UINT32_MAX;
+      std::uint32_t done_cycles = UINT32_MAX;
+      bool is_on_dma = false;
+
+      for (std::uint32_t j = 0U; j < iterations; j++) {
+        const std::uint32_t cycles_start = CycleCounter::Get();
+        std::uint32_t elapsed;
+
+        is_on_dma = MemoryCopyAsync(&copy[offset], &buffer[0], size, nullptr, nullptr);
+        elapsed = CycleCounter::Get() - cycles_start;
+        start_cycles = (elapsed < start_cycles) ? elapsed : start_cycles;
+        while (MemoryCopyAsyncIsBusy()) {
+        }
+        elapsed = CycleCounter::Get() - cycles_start;
+        done_cycles = (elapsed < done_cycles) ? elapsed : done_cycles;
+      }
+      if (0 != std::memcmp(&copy[offset], &buffer[0], size)) {
+        (void) std::printf("%s: dma copy error at offset %" PRIu32 ", length %" PRIu32 "\n",
+                           this->getName(), offset, size);
+        status = -1;
+      }
+      (void) std::printf("dma,%" PRIu32 ",0,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",",
+                         size, offset, start_cycles, done_cycles);
+      AppConsoleCpuBench::PrintCyclesPerByte(done_cycles, size, is_on_dma ? ",1\n" : ",0\n");
+    }
+  }
+  return status;
+}
+
+/* The ring of the HCI FIFO against a queue of the RTOS with the same depth, one put then one get
+ * with nobody waiting on the other side.
+ * The stress test then runs a producer thread above and below the console thread priority,
+ * so that both the consumer and the producer have to sleep, and checks the order of the elements.
+ */
+std::int32_t AppConsoleCpuBench::doRing(std::uint32_t iterations) noexcept
+{
+  static const char ring_data_name[] = {"CpuBenchRingData"};
+  static const char ring_space_name[] = {"CpuBenchRingSpace"};
+  static const char queue_name[] = {"CpuBenchQueue"};
+  std::unique_ptr<AppConsoleCpuBench::Ring_t> ring_ptr(new AppConsoleCpuBench::Ring_t());
+  EmwOsInterface::Queue_t queue;
+  std::int32_t status = 0;
+
+  if (EmwOsInterface::eOK != ring_ptr->initialize(ring_data_name, ring_space_name)) {
+    (void) std::printf("%s: no memory\n", this->getName());
+    return -1;
+  }
+  if (EmwOsInterface::eOK != EmwOsInterface::CreateMessageQueue(queue, queue_name, 4U)) {
+    ring_ptr->unInitialize();
+    (void) std::printf("%s: no memory\n", this->getName());
+    return -1;
+  }
+  {
+    std::uint32_t element = 0U;
+    std::uint32_t put_cycles = UINT32_MAX;
+    std::uint32_t get_cycles = UINT32_MAX;
+    std::uint32_t ref_put_cycles = UINT32_MAX;
+    std::uint32_t ref_get_cycles = UINT32_MAX;
+
+    for (std::uint32_t j = 0U; j < iterations; j++) {
+      const void *message_ptr = nullptr;
+      std::uint32_t cycles_start = CycleCounter::Get();
+      std::uint32_t elapsed;
+
+      (void) ring_ptr->put(&element, 0U);
+      elapsed = CycleCounter::Get() - cycles_start;
+      put_cycles = (elapsed < put_cycles) ? elapsed : put_cycles;
+
+      cycles_start = CycleCounter::Get();
+      if (&element != ring_ptr->get(0U)) {
+        status = -1;
+      }
+      elapsed = CycleCounter::Get() - cycles_start;
+      get_cycles = (elapsed < get_cycles) ? elapsed : get_cycles;
+
+      cycles_start = CycleCounter::Get();
+      (void) EmwOsInterface::PutMessageQueue(queue, &element, 0U);
+      elapsed = CycleCounter::Get() - cycles_start;
+      ref_put_cycles = (elapsed < ref_put_cycles) ? elapsed : ref_put_cycles;
+
+      cycles_start = CycleCounter::Get();
+      (void) EmwOsInterface::GetMessageQueue(queue, 0U, message_ptr);
+      elapsed = CycleCounter::Get() - cycles_start;
+      ref_get_cycles = (elapsed < ref_get_cycles) ? elapsed : ref_get_cycles;
+    }
+    (void) std::printf("test,operation,cycles,ref_cycles\n");
+    (void) std::printf("ring,put,%" PRIu32 ",%" PRIu32 "\n", put_cycles, ref_put_cycles);
+    (void) std::printf("ring,get,%" PRIu32 ",%" PRIu32 "\n", get_cycles, ref_get_cycles);
+  }
+  EmwOsInterface::DeleteMessageQueue(queue);
+
+  if (0 == status) {
+    const EmwOsInterface::ThreadPriority_t priority = uxTaskPriorityGet(nullptr);
+
+    (void) std::printf("test,producer_priority,count,errors,cycles_per_element,consumer_wake_ups,producer_wake_ups\n");
+    status = this->doRingStress(*ring_ptr, priority + 1U);
+    if (0 == status) {
+      status = this->doRingStress(*ring_ptr, priority - 1U);
+    }
+  }
+  ring_ptr->unInitialize();
+  return status;
+}
+
+/* The elements are the sequence numbers, never 0 so that they are not taken for an empty get. */
+std::int32_t AppConsoleCpuBench::doRingStress(AppConsoleCpuBench::Ring_t &ring,
+    EmwOsInterface::ThreadPriority_t priority) noexcept
+{
+  static const char producer_thread_name[] = {"CpuBenchRingProducer"};
+  AppConsoleCpuBench::Ring_t::Statistics_t statistics_start;
+  AppConsoleCpuBench::Ring_t::Statistics_t statistics;
+  AppConsoleCpuBench::RingProducer_t producer = {&ring, AppConsoleCpuBench::RING_STRESS_COUNT, true};
+  EmwOsInterface::Thread_t producer_thread;
+  std::uint32_t errors = 0U;
+  std::uint32_t received = 0U;
+  const std::uint32_t cycles_start = CycleCounter::Get();
+  std::uint32_t cycles;
+
+  ring.getStatistics(statistics_start);
+  if (EmwOsInterface::eOK != EmwOsInterface::CreateThread(producer_thread, producer_thread_name,
+      AppConsoleCpuBench::RingProducerThreadFunction, &producer,
+      EMW_OS_MINIMAL_THREAD_STACK_SIZE, priority)) {
+    (void) std::printf("%s: no memory\n", this->getName());
+    return -1;
+  }
+  while (received < AppConsoleCpuBench::RING_STRESS_COUNT) {
+    const std::uint32_t * const element_ptr = ring.get(1000U);
+
+    if (nullptr == element_ptr) {
+      errors++;
+      break;
+    }
+    received++;
+    if (reinterpret_cast<std::uintptr_t>(element_ptr) != received) {
+      errors++;
+    }
+  }
+  cycles = CycleCounter::Get() - cycles_start;
+  while (producer.isRunning) {
+    EmwOsInterface::DelayTicks(1U);
+  }
+  ring.getStatistics(statistics);
+  (void) std::printf("ring_stress,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\n",
+                     static_cast<std::uint32_t>(priority), received, errors,
+                     (0U != received) ? (cycles / received) : 0U,
+                     statistics.consumerWakeUps - statistics_start.consumerWakeUps,
+                     statistics.producerWakeUps - statistics_start.producerWakeUps);
+  return (0U == errors) ? 0 : -1;
+}
+
+void AppConsoleCpuBench::PrintCyclesPerByte(std::uint32_t cycles, std::uint32_t size,
+    const char *separatorStringPtr) noexcept
+{
+  (void) std::printf("%" PRIu32 ".%02" PRIu32 "%s", cycles / size, ((cycles % size) * 100U) / size,
+                     separatorStringPtr);
+}
+
+/* xorshift32, the state must not be 0. */
+std::uint32_t AppConsoleCpuBench::NextRandom(std::uint32_t &state) noexcept
+{
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+void AppConsoleCpuBench::RingProducerThreadFunction(EmwOsInterface::ThreadFunctionArgument_t argumentPtr) noexcept
+{
+  AppConsoleCpuBench::RingProducer_t * const producer_ptr \
+    = static_cast<AppConsoleCpuBench::RingProducer_t *>(const_cast<void *>(argumentPtr));
+
+  for (std::uint32_t i = 1U; i <= producer_ptr->count; i++) {
+    if (!producer_ptr->ringPtr->put(reinterpret_cast<std::uint32_t *>(static_cast<std::uintptr_t>(i)), 1000U)) {
+      break;
+    }
+  }
+  producer_ptr->isRunning = false;
+  EmwOsInterface::ExitThread();
+}
+
+const std::uint16_t AppConsoleCpuBench::COPY_SIZES[] = {16U, 64U, 256U, 512U, 1024U, 1536U, 0U};
+
+const std::uint16_t AppConsoleCpuBench::SIZES[] = {20U, 64U, 256U, 576U, 1460U, 0U};
@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "Console.hpp"
+#include "EmwOsInterface.hpp"
+#include "EmwSpscRing.hpp"
+#include <cstdint>
+
+class AppConsoleCpuBench final : public Cmd {
+  public:
+    explicit AppConsoleCpuBench(void) noexcept;
+  public:
+    virtual ~AppConsoleCpuBench(void) noexcept override;
+  public:
+    std::int32_t execute(std::int32_t argc, char *argvPtrs[]) noexcept override;
+  public:
+    const char *getComment(void) const noexcept override
+    {
+      return "cpubench [-tchksum] [-tmemcpy] [-tdma] [-tring] [-nIterations]"
+             " (checks the optimized routines against their reference, cycles in CSV output)";
+    }
+  public:
+    const char *getName(void) const noexcept override
+    {
+      return "cpubench";
+    }
+
+  private:
+    enum /*class*/ Test : std::uint32_t {
+      eTEST_CHECKSUM = 0x01U,
+      eTEST_MEMORY_COPY = 0x02U,
+      eTEST_DMA_COPY = 0x04U,
+      eTEST_RING = 0x08U
+    };
+
+  private:
+    typedef EmwSpscRing<std::uint32_t, 4U> Ring_t;
+
+  private:
+    typedef struct RingProducer_s {
+      AppConsoleCpuBench::Ring_t *ringPtr;
+      std::uint32_t count;
+      volatile bool isRunning;
+    } RingProducer_t;
+
+  private:
+    std::int32_t doChecksum(std::uint32_t iterations, std::uint8_t (&buffer)[]) noexcept;
+  private:
+    std::int32_t doDmaCopy(std::uint32_t iterations, std::uint8_t (&buffer)[], std::uint8_t (&copy)[]) noexcept;
+  private:
+    std::int32_t doMemoryCopy(std::uint32_t iterations, std::uint8_t (&buffer)[], std::uint8_t (&copy)[]) noexcept;
+  private:
+    std::int32_t doRing(std::uint32_t iterations) noexcept;
+  private:
+    std::int32_t doRingStress(AppConsoleCpuBench::Ring_t &ring, EmwOsInterface::ThreadPriority_t priority) noexcept;
+  private:
+    static std::uint32_t NextRandom(std::uint32_t &state) noexcept;
+  private:
+    static void PrintCyclesPerByte(std::uint32_t cycles, std::uint32_t size, const char *separatorStringPtr) noexcept;
+  private:
+    static void RingProducerThreadFunction(EmwOsInterface::ThreadFunctionArgument_t argumentPtr) noexcept;
+
+  private:
+    static const std::uint32_t BUFFER_SIZE = 1600U;
+  private:
+    static const std::uint32_t CHECK_COUNT = 2000U;
+  private:
+    static const std::uint16_t COPY_SIZES[];
+  private:
+    static const std::uint32_t ITERATIONS = 100U;
+  private:
+    static const std::uint32_t RING_STRESS_COUNT = 100000U;
+  private:
+    static const std::uint16_t SIZES[];
+};
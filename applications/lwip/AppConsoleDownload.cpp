@@ -28,6 +28,7 @@
 #include <cinttypes>
 #include <cstring>
 #include <cstdio>
+#include <cstdlib>
 #include <memory>
 #include <stdexcept>
 #include <system_error>
@@ -37,6 +38,7 @@
 
 AppConsoleDownload::AppConsoleDownload(void) noexcept
   : userDownloadLength(0)
+  , connectionPool()
 {
   STD_PRINTF("AppConsoleDownload::AppConsoleDownload()>\n")
   STD_PRINTF("AppConsoleDownload::AppConsoleDownload(): %p\n", static_cast<const void*>(&emw))
@@ -46,6 +48,7 @@ AppConsoleDownload::AppConsoleDownload(void) noexcept
 AppConsoleDownload::~AppConsoleDownload(void) noexcept
 {
   STD_PRINTF("AppConsoleDownload::~AppConsoleDownload()>\n")
+  this->closeConnections();
   STD_PRINTF("AppConsoleDownload::~AppConsoleDownload()< %p\n", static_cast<const void*>(&emw))
 }
 
@@ -59,6 +62,8 @@ std::int32_t AppConsoleDownload::execute(std::int32_t argc, char *argvPtrs[]) no
   char *host_name_ptr = nullptr;
   const char *http_request_ptr;
   struct sockaddr *s_address_ptr = nullptr;
+  std::uint32_t benchmark_count = 0U;
+  std::uint32_t stream_count = 0U;
 
   STD_PRINTF("AppConsoleDownload::execute()>\n")
 
@@ -76,6 +81,12 @@ std::int32_t AppConsoleDownload::execute(std::int32_t argc, char *argvPtrs[]) no
         else if (0 == std::strncmp("-l", argvPtrs[i], 2)) {
           this->userDownloadLength = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
         }
+        else if (0 == std::strncmp("-n", argvPtrs[i], 2)) {
+          benchmark_count = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+        }
+        else if (0 == std::strncmp("-p", argvPtrs[i], 2)) {
+          stream_count = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+        }
         else {
           host_request_string_ptr = argvPtrs[i];
         }
@@ -93,6 +104,12 @@ std::int32_t AppConsoleDownload::execute(std::int32_t argc, char *argvPtrs[]) no
   if ((nullptr == host_name_ptr) || (nullptr == http_request_ptr)) {
     (void) std::printf("%s: invalid URL \"%s\"\n", this->getName(), host_request_string_ptr);
   }
+  else if (0U != benchmark_count) {
+    status = this->doBenchmark(host_name_ptr, http_request_ptr, benchmark_count, use_ipv6);
+  }
+  else if (0U != stream_count) {
+    status = this->doParallelDownload(host_name_ptr, http_request_ptr, stream_count, use_ipv6);
+  }
   else {
     std::int32_t socket = -1;
 
@@ -157,6 +174,103 @@ std::int32_t AppConsoleDownload::execute(std::int32_t argc, char *argvPtrs[]) no
   return status;
 }
 
+void AppConsoleDownload::closeConnections(void) noexcept
+{
+  for (AppConsoleDownload::Connection_t &connection : this->connectionPool) {
+    if (0 <= connection.socket) {
+      (void) lwip_close(connection.socket);
+      connection.socket = -1;
+    }
+  }
+}
+
+std::int32_t AppConsoleDownload::doBenchmark(const char *hostStringPtr, const char *requestStringPtr,
+    std::uint32_t count, bool useIpv6) noexcept
+{
+  std::int32_t status = 0;
+  char host_string[128] = {""};
+  std::uint16_t port = AppConsoleDownload::REMOTE_TCP_PORT;
+  AppConsoleDownload::Timing_t new_timing;
+  AppConsoleDownload::Timing_t pooled_timing;
+  std::uint32_t reused_count = 0U;
+
+  (void) std::strncpy(host_string, hostStringPtr, sizeof(host_string) - 1U);
+  /* An IPv4 host may come with its port, as in "host:8080". */
+  if (!useIpv6) {
+    char *const port_ptr = std::strchr(host_string, ':');
+
+    if (nullptr != port_ptr) {
+      *port_ptr = '\0';
+      port = static_cast<std::uint16_t>(std::atoi(port_ptr + 1));
+    }
+  }
+  (void) std::printf("%s: %" PRIu32 " requests of \"%s\" to %s:%" PRIu32 "\n", this->getName(), count,
+                     requestStringPtr, host_string, static_cast<std::uint32_t>(port));
+
+  /* Without reuse, each request pays the name resolution and the TCP connection. */
+  (void) std::printf("%s: new connection per request ", this->getName());
+  for (std::uint32_t i = 0U; (i < count) && (0 == status); i++) {
+    const std::uint32_t tstart = HAL_GetTick();
+    const std::int32_t socket = this->openConnection(host_string, port, useIpv6);
+
+    if ((0 > socket) || (0 > this->doRequest(socket, host_string, requestStringPtr, false))) {
+      (void) std::printf("x");
+      status = -1;
+    }
+    else {
+      new_timing.add(HAL_GetTick() - tstart);
+      (void) std::printf(".");
+    }
+    if (0 <= socket) {
+      (void) lwip_close(socket);
+    }
+  }
+  (void) std::printf("\n");
+
+  /* With the pool, only the first request or the one after a close by the server pays them. */
+  (void) std::printf("%s: pooled keep-alive connection ", this->getName());
+  for (std::uint32_t i = 0U; (i < count) && (0 == status); i++) {
+    const std::uint32_t tstart = HAL_GetTick();
+    bool is_reused = false;
+    std::int32_t socket = this->takeConnection(host_string, port, useIpv6, is_reused);
+    std::int32_t request_status = (0 > socket) ? -1 : this->doRequest(socket, host_string, requestStringPtr, true);
+
+    /* The server may have closed the idle connection meanwhile, so retry once with a new one. */
+    if ((0 > request_status) && is_reused) {
+      (void) lwip_close(socket);
+      is_reused = false;
+      socket = this->openConnection(host_string, port, useIpv6);
+      request_status = (0 > socket) ? -1 : this->doRequest(socket, host_string, requestStringPtr, true);
+    }
+    if (0 > request_status) {
+      (void) std::printf("x");
+      status = -1;
+      if (0 <= socket) {
+        (void) lwip_close(socket);
+      }
+    }
+    else {
+      pooled_timing.add(HAL_GetTick() - tstart);
+      if (is_reused) {
+        reused_count++;
+      }
+      if (0 == request_status) {
+        this->giveBackConnection(host_string, port, socket);
+      }
+      else {
+        (void) lwip_close(socket);
+      }
+      (void) std::printf(is_reused ? "." : "o");
+    }
+  }
+  (void) std::printf("\n");
+  this->printTiming("new", new_timing);
+  this->printTiming("pooled", pooled_timing);
+  (void) std::printf("%s: %" PRIu32 " of %" PRIu32 " pooled requests reused a connection\n", this->getName(),
+                     reused_count, pooled_timing.count);
+  return status;
+}
+
 std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char *hostPtr,
     const char *requestPtr) const noexcept
 {
@@ -176,6 +290,7 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
     AppConsoleDownload::HttpContext_t http_ctx;
     const std::uint32_t buffer_size = EmwNetworkStack::NETWORK_BUFFER_SIZE - 1;
     std::uint32_t ret_size = 0;
+    std::uint32_t body_size = 0;
     std::uint64_t length = 0;
     std::uint32_t cpt_count = 0;
 
@@ -187,7 +302,7 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
               buffer_ptr.get(),
               std::strlen(reinterpret_cast<char *>(buffer_ptr.get())), 0);
 
-    if (this->readResponse(socket, buffer_ptr.get(), buffer_size, ret_size) != 0) {
+    if (this->readResponse(socket, buffer_ptr.get(), buffer_size, ret_size, body_size) != 0) {
       throw std::runtime_error("no answer from HTTP server");
     }
 
@@ -205,6 +320,12 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
                          this->getName(), this->userDownloadLength, AppConsoleDownload::REPORT_TIMEPERIOD_MS);
       length = this->userDownloadLength;
     }
+    /* The first body bytes came with the header. */
+    if (body_size > length) {
+      body_size = static_cast<std::uint32_t>(length);
+    }
+    length -= body_size;
+    cpt_count += body_size;
 
     local_start_time_in_ms = start_time_in_ms = HAL_GetTick();
 
@@ -263,36 +384,367 @@ std::int32_t AppConsoleDownload::doDownloadFile(std::int32_t socket, const char
   return status;
 }
 
-std::int32_t AppConsoleDownload::readResponse(std::int32_t socket, unsigned char *headerPtr, std::uint32_t maximumSize,
-    std::uint32_t &retSize) const noexcept
+/* Splits the first bytes of the file in as many Range requests as streams, all received together with select.
+ * The data are dropped, only the throughputs are reported.
+ */
+std::int32_t AppConsoleDownload::doParallelDownload(const char *hostStringPtr, const char *requestStringPtr,
+    std::uint32_t streamCount, bool useIpv6) noexcept
 {
-  char *string_ptr = reinterpret_cast<char *>(headerPtr);
-  std::uint32_t header_size = maximumSize;
-  std::uint32_t count = 0;
+  std::int32_t status = 0;
+  AppConsoleDownload::Stream_t streams[AppConsoleDownload::PARALLEL_STREAM_COUNT_MAX];
+  std::unique_ptr<std::uint8_t, decltype(&vPortFree)> \
+  buffer_ptr(static_cast<std::uint8_t *>(pvPortCalloc(EmwNetworkStack::NETWORK_BUFFER_SIZE, sizeof(*buffer_ptr))),
+             &vPortFree);
+  const std::uint32_t buffer_size = EmwNetworkStack::NETWORK_BUFFER_SIZE - 1;
+  std::uint64_t length = 0U;
+  std::uint32_t tstart;
 
-  retSize = 0U;
+  if (streamCount > AppConsoleDownload::PARALLEL_STREAM_COUNT_MAX) {
+    streamCount = AppConsoleDownload::PARALLEL_STREAM_COUNT_MAX;
+  }
+  if (nullptr == buffer_ptr) {
+    (void) std::printf("%s: memory allocation failed\n", this->getName());
+    return -1;
+  }
+  if (0 != this->getContentLength(hostStringPtr, requestStringPtr, useIpv6, length)) {
+    (void) std::printf("%s: failed to get the file size\n", this->getName());
+    return -1;
+  }
+  (void) std::printf("%s: file size %" PRIu32 " bytes\n", this->getName(), static_cast<std::uint32_t>(length));
+  if (length > this->userDownloadLength) {
+    length = this->userDownloadLength;
+  }
+  (void) std::printf("%s: downloading %" PRIu32 " bytes with %" PRIu32 " streams\n", this->getName(),
+                     static_cast<std::uint32_t>(length), streamCount);
 
-  while (header_size > 0) {
-    std::int32_t ret = lwip_recv(socket, string_ptr, 1, 0);
-    if (ret < 0) {
-      return ret;
+  tstart = HAL_GetTick();
+  {
+    const std::uint64_t range_size = (length + streamCount - 1U) / streamCount;
+
+    for (std::uint32_t i = 0U; (i < streamCount) && (0 == status); i++) {
+      AppConsoleDownload::Stream_t &stream = streams[i];
+
+      stream.offset = range_size * i;
+      if (stream.offset >= length) {
+        continue;
+      }
+      stream.remaining = ((length - stream.offset) < range_size) ? (length - stream.offset) : range_size;
+      stream.startInMs = HAL_GetTick();
+      stream.socket = this->openConnection(hostStringPtr, AppConsoleDownload::REMOTE_TCP_PORT, useIpv6);
+      if (0 > stream.socket) {
+        (void) std::printf("%s: stream %" PRIu32 " failed to connect\n", this->getName(), i);
+        status = -1;
+      }
+      else {
+        char *const request_ptr = reinterpret_cast<char *>(buffer_ptr.get());
+        std::size_t request_length;
+
+        (void) std::snprintf(request_ptr, buffer_size,
+                             "GET %s HTTP/1.1\r\nHost:%s\r\nUser-Agent:EMW\r\nRange:bytes=%" PRIu64 "-%" PRIu64
+                             "\r\nConnection:close\r\n\r\n", requestStringPtr, hostStringPtr,
+                             stream.offset, stream.offset + stream.remaining - 1U);
+        request_length = std::strlen(request_ptr);
+        if (static_cast<ssize_t>(request_length) != lwip_send(stream.socket, request_ptr, request_length, 0)) {
+          status = -1;
+        }
+      }
+    }
+  }
+  /* All the requests are in flight, the headers are then read one stream after the other. */
+  for (std::uint32_t i = 0U; (i < streamCount) && (0 == status); i++) {
+    AppConsoleDownload::Stream_t &stream = streams[i];
+
+    if (0 != stream.remaining) {
+      AppConsoleDownload::HttpContext_t http_ctx;
+      std::uint32_t ret_size = 0U;
+      std::uint32_t body_size = 0U;
+
+      if (0 != this->readResponse(stream.socket, buffer_ptr.get(), buffer_size, ret_size, body_size)) {
+        (void) std::printf("%s: stream %" PRIu32 " no answer from HTTP server\n", this->getName(), i);
+        status = -1;
+        break;
+      }
+      if ((0 != this->testResponse(http_ctx, buffer_ptr.get())) \
+          || (AppConsoleDownload::HTTP_RESPONSE_PARTIAL_CONTENT != http_ctx.status) \
+          || (stream.remaining != http_ctx.contentLength)) {
+        (void) std::printf("%s: stream %" PRIu32 " the server does not honor the Range request (%" PRIu32 ")\n",
+                           this->getName(), i, http_ctx.status);
+        status = -1;
+      }
+      else {
+        /* The first body bytes came with the header. */
+        if (body_size > stream.remaining) {
+          body_size = static_cast<std::uint32_t>(stream.remaining);
+        }
+        stream.received += body_size;
+        stream.remaining -= body_size;
+        if (0U == stream.remaining) {
+          stream.endInMs = HAL_GetTick();
+        }
+      }
+    }
+  }
+  while (0 == status) {
+    fd_set read_fds;
+    std::int32_t max_fd = -1;
+
+    FD_ZERO(&read_fds);
+    for (const AppConsoleDownload::Stream_t &stream : streams) {
+      if (0 != stream.remaining) {
+        FD_SET(stream.socket, &read_fds);
+        max_fd = (stream.socket > max_fd) ? stream.socket : max_fd;
+      }
+    }
+    if (0 > max_fd) {
+      break;
+    }
+    {
+      struct timeval timeout = {AppConsoleDownload::TIMEOUT_10S_DEFINED / 1000, 0};
+
+      if (0 >= lwip_select(max_fd + 1, &read_fds, nullptr, nullptr, &timeout)) {
+        (void) std::printf("\n%s: time out\n", this->getName());
+        status = -1;
+        break;
+      }
+    }
+    for (AppConsoleDownload::Stream_t &stream : streams) {
+      if ((0 != stream.remaining) && FD_ISSET(stream.socket, &read_fds)) {
+        const std::uint32_t size_in_bytes \
+          = (buffer_size < stream.remaining) ? buffer_size : static_cast<std::uint32_t>(stream.remaining);
+        const std::int32_t count = lwip_recv(stream.socket, buffer_ptr.get(), size_in_bytes, 0);
+
+        if (0 >= count) {
+          status = -1;
+          break;
+        }
+        (void) std::printf(".");
+        stream.received += static_cast<std::uint64_t>(count);
+        stream.remaining -= static_cast<std::uint64_t>(count);
+        if (0U == stream.remaining) {
+          stream.endInMs = HAL_GetTick();
+        }
+      }
+    }
+  }
+  {
+    const std::uint32_t duration_in_ms = HAL_GetTick() - tstart;
+    std::uint64_t received = 0U;
+
+    (void) std::printf("\n");
+    for (std::uint32_t i = 0U; i < streamCount; i++) {
+      AppConsoleDownload::Stream_t &stream = streams[i];
+
+      if (0 <= stream.socket) {
+        const std::uint32_t stream_duration_in_ms \
+          = ((0U != stream.endInMs) ? stream.endInMs : HAL_GetTick()) - stream.startInMs;
+
+        lwip_shutdown(stream.socket, SHUT_RD);
+        lwip_close(stream.socket);
+        received += stream.received;
+        (void) std::printf("%s: stream %" PRIu32 " offset %" PRIu32 ", transfer %" PRIu32 " bytes, duration %" PRIu32
+                           " ms, bitrate %" PRIu32 " kbit/s\n", this->getName(), i,
+                           static_cast<std::uint32_t>(stream.offset), static_cast<std::uint32_t>(stream.received),
+                           stream_duration_in_ms,
+                           (0U != stream_duration_in_ms) \
+                           ? static_cast<std::uint32_t>((8U * stream.received) / stream_duration_in_ms) : 0U);
+      }
+    }
+    if (0U != duration_in_ms) {
+      (void) std::printf("%s: aggregate transfer %" PRIu32 " bytes, duration %" PRIu32 " ms, bitrate %" PRIu32
+                         " kbit/s\n", this->getName(), static_cast<std::uint32_t>(received), duration_in_ms,
+                         static_cast<std::uint32_t>((8U * received) / duration_in_ms));
+    }
+  }
+  return status;
+}
+
+/* Sends one GET and reads the whole response.
+ * Returns 0 when the connection can carry another request, 1 when the server closes it, -1 on error.
+ */
+std::int32_t AppConsoleDownload::doRequest(std::int32_t socket, const char *hostStringPtr,
+    const char *requestStringPtr, bool keepAlive) const noexcept
+{
+  std::int32_t status = -1;
+  std::unique_ptr<std::uint8_t, decltype(&vPortFree)> \
+  buffer_ptr(static_cast<std::uint8_t *>(pvPortCalloc(EmwNetworkStack::NETWORK_BUFFER_SIZE, sizeof(*buffer_ptr))),
+             &vPortFree);
+  const std::uint32_t buffer_size = EmwNetworkStack::NETWORK_BUFFER_SIZE - 1;
+
+  if (nullptr != buffer_ptr) {
+    AppConsoleDownload::HttpContext_t http_ctx;
+    std::uint32_t ret_size = 0;
+    std::uint32_t body_size = 0;
+    std::size_t request_length;
+
+    *(buffer_ptr.get() + buffer_size) = '\0';
+    (void) std::snprintf(reinterpret_cast<char *>(buffer_ptr.get()), buffer_size,
+                         "GET %s HTTP/1.1\r\nHost:%s\r\nUser-Agent:EMW\r\nConnection:%s\r\n\r\n",
+                         requestStringPtr, hostStringPtr, keepAlive ? "keep-alive" : "close");
+    request_length = std::strlen(reinterpret_cast<char *>(buffer_ptr.get()));
+
+    if ((static_cast<ssize_t>(request_length) == lwip_send(socket, buffer_ptr.get(), request_length, 0)) \
+        && (0 == this->readResponse(socket, buffer_ptr.get(), buffer_size, ret_size, body_size))) {
+      if (0 == this->testResponse(http_ctx, buffer_ptr.get())) {
+        /* Without a length, the end of the body is the close of the connection. */
+        const bool has_length = (static_cast<std::uint64_t>(-1) != http_ctx.contentLength);
+        std::uint64_t length = http_ctx.contentLength;
+
+        if (has_length) {
+          length = (length > body_size) ? (length - body_size) : 0U;
+        }
+
+        status = (has_length && keepAlive && http_ctx.keepAlive) ? 0 : 1;
+        while ((!has_length) || (0U != length)) {
+          const std::uint32_t size_in_bytes = (buffer_size < length) ? buffer_size : static_cast<std::uint32_t>(length);
+          const std::int32_t count = lwip_recv(socket, buffer_ptr.get(), size_in_bytes, 0);
+          if (0 >= count) {
+            if (has_length) {
+              status = -1;
+            }
+            break;
+          }
+          length = (length > static_cast<std::uint64_t>(count)) ? (length - static_cast<std::uint64_t>(count)) : 0U;
+        }
+      }
+    }
+  }
+  return status;
+}
+
+std::int32_t AppConsoleDownload::getContentLength(const char *hostStringPtr, const char *requestStringPtr,
+    bool useIpv6, std::uint64_t &length) noexcept
+{
+  std::int32_t status = -1;
+  const std::int32_t socket = this->openConnection(hostStringPtr, AppConsoleDownload::REMOTE_TCP_PORT, useIpv6);
+
+  if (0 <= socket) {
+    char header[512];
+    std::uint32_t ret_size = 0U;
+    std::uint32_t body_size = 0U;
+    std::size_t request_length;
+
+    (void) std::snprintf(header, sizeof(header), "HEAD %s HTTP/1.1\r\nHost:%s\r\nUser-Agent:EMW\r\n"
+                         "Connection:close\r\n\r\n", requestStringPtr, hostStringPtr);
+    request_length = std::strlen(header);
+    if ((static_cast<ssize_t>(request_length) == lwip_send(socket, header, request_length, 0)) \
+        && (0 == this->readResponse(socket, reinterpret_cast<unsigned char *>(header), sizeof(header) - 1U,
+                                    ret_size, body_size))) {
+      AppConsoleDownload::HttpContext_t http_ctx;
+
+      if ((0 == this->testResponse(http_ctx, reinterpret_cast<unsigned char *>(header))) \
+          && (static_cast<std::uint64_t>(-1) != http_ctx.contentLength)) {
+        length = http_ctx.contentLength;
+        status = 0;
+      }
     }
+    lwip_close(socket);
+  }
+  return status;
+}
 
-    string_ptr++;
-    header_size--;
-    count++;
-    if ((count > 4) && (std::strncmp(string_ptr - 4, "\r\n\r\n", 4) == 0)) {
+void AppConsoleDownload::giveBackConnection(const char *hostStringPtr, std::uint16_t port, std::int32_t socket) noexcept
+{
+  AppConsoleDownload::Connection_t *connection_ptr = &this->connectionPool[0];
+
+  /* Takes a free entry, otherwise closes the least recently used connection. */
+  for (AppConsoleDownload::Connection_t &connection : this->connectionPool) {
+    if (0 > connection.socket) {
+      connection_ptr = &connection;
       break;
     }
+    if ((connection.lastUseInMs - connection_ptr->lastUseInMs) > (UINT32_MAX / 2U)) {
+      connection_ptr = &connection;
+    }
   }
+  if (0 <= connection_ptr->socket) {
+    (void) lwip_close(connection_ptr->socket);
+  }
+  (void) std::strncpy(connection_ptr->hostString, hostStringPtr, sizeof(connection_ptr->hostString) - 1U);
+  connection_ptr->hostString[sizeof(connection_ptr->hostString) - 1U] = '\0';
+  connection_ptr->port = port;
+  connection_ptr->socket = socket;
+  connection_ptr->lastUseInMs = HAL_GetTick();
+}
 
-  if (header_size == 0) {
-    return -1;
+std::int32_t AppConsoleDownload::openConnection(const char *hostStringPtr, std::uint16_t port, bool useIpv6) noexcept
+{
+  std::int32_t socket = -1;
+  struct sockaddr_in s_address_in = {sizeof(s_address_in), AF_INET, lwip_htons(port), {0}, {0}};
+  struct sockaddr_storage s_address_storage;
+  struct sockaddr *s_address_ptr = reinterpret_cast<struct sockaddr *>(&s_address_in);
+
+  if (useIpv6) {
+    /* The IPv6 resolution wants room for any address. */
+    (void) std::memset(&s_address_storage, 0, sizeof(s_address_storage));
+    s_address_storage.s2_len = sizeof(s_address_storage);
+    s_address_storage.ss_family = AF_INET6;
+    s_address_ptr = reinterpret_cast<struct sockaddr *>(&s_address_storage);
   }
+  if (0 <= AppLwipService::getHostByName(s_address_ptr, hostStringPtr)) {
+    const std::int32_t timeout_in_ms = AppConsoleDownload::TIMEOUT_10S_DEFINED;
 
-  retSize = count;
+    if (useIpv6) {
+      struct sockaddr_in6 *const s_address_in6_ptr = reinterpret_cast<struct sockaddr_in6 *>(&s_address_storage);
 
-  return 0;
+      s_address_in6_ptr->sin6_len = sizeof(*s_address_in6_ptr);
+      s_address_in6_ptr->sin6_port = lwip_htons(port);
+    }
+    socket = lwip_socket(s_address_ptr->sa_family, SOCK_STREAM, IPPROTO_TCP);
+    if ((0 <= socket) \
+        && ((0 != lwip_setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, &timeout_in_ms, sizeof(timeout_in_ms))) \
+            || (0 != lwip_setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, &timeout_in_ms, sizeof(timeout_in_ms))) \
+            || (0 != lwip_connect(socket, s_address_ptr, s_address_ptr->sa_len)))) {
+      (void) lwip_close(socket);
+      socket = -1;
+    }
+  }
+  return socket;
+}
+
+void AppConsoleDownload::printTiming(const char *nameStringPtr, const AppConsoleDownload::Timing_t &timing) const noexcept
+{
+  if (0U != timing.count) {
+    (void) std::printf("%s: %-6s %" PRIu32 " requests, min %" PRIu32 " ms, avg %" PRIu32 " ms, max %" PRIu32 " ms\n",
+                       this->getName(), nameStringPtr, timing.count, timing.min,
+                       static_cast<std::uint32_t>(timing.sum / timing.count), timing.max);
+  }
+}
+
+/* Reads the header by chunks, as each lwip_recv() is a round trip to the tcpip thread.
+ * The header is NUL terminated in place of its last "\r", the body bytes received with it follow it.
+ */
+std::int32_t AppConsoleDownload::readResponse(std::int32_t socket, unsigned char *headerPtr, std::uint32_t maximumSize,
+    std::uint32_t &retSize, std::uint32_t &bodySize) const noexcept
+{
+  std::uint32_t count = 0U;
+
+  retSize = 0U;
+  bodySize = 0U;
+
+  while (count < maximumSize) {
+    const std::int32_t ret = lwip_recv(socket, &headerPtr[count], maximumSize - count, 0);
+    if (ret < 0) {
+      return ret;
+    }
+    if (ret == 0) {
+      return -1;
+    }
+    {
+      /* The end of the header may straddle the previous chunk. */
+      std::uint32_t i = (count > 3U) ? (count - 3U) : 0U;
+
+      count += static_cast<std::uint32_t>(ret);
+      for (; (i + 4U) <= count; i++) {
+        if (std::memcmp(&headerPtr[i], "\r\n\r\n", 4U) == 0) {
+          headerPtr[i + 2U] = '\0';
+          retSize = i + 4U;
+          bodySize = count - retSize;
+          return 0;
+        }
+      }
+    }
+  }
+  return -1;
 }
 
 std::uint32_t AppConsoleDownload::serviceLines(unsigned char *bufferPtr, char *linePtrs[],
@@ -376,16 +828,37 @@ void AppConsoleDownload::splitHostRequest(const char *urlStringPtr, char * &host
   }
 }
 
+std::int32_t AppConsoleDownload::takeConnection(const char *hostStringPtr, std::uint16_t port, bool useIpv6,
+    bool &isReused) noexcept
+{
+  std::int32_t socket = -1;
+
+  for (AppConsoleDownload::Connection_t &connection : this->connectionPool) {
+    if ((0 <= connection.socket) && (port == connection.port) \
+        && (0 == std::strncmp(hostStringPtr, connection.hostString, sizeof(connection.hostString)))) {
+      socket = connection.socket;
+      connection.socket = -1;
+      break;
+    }
+  }
+  isReused = (0 <= socket);
+  if (!isReused) {
+    socket = this->openConnection(hostStringPtr, port, useIpv6);
+  }
+  return socket;
+}
+
 std::int32_t AppConsoleDownload::testResponse(AppConsoleDownload::HttpContext_t &context,
     unsigned char *bufferPtr) const noexcept
 {
-  char *line_ptrs[10] = {nullptr};
+  char *line_ptrs[16] = {nullptr};
   const std::uint32_t line_ptrs_count = this->serviceLines(bufferPtr, &line_ptrs[0],
                                         sizeof(line_ptrs) / sizeof(line_ptrs[0]));
 
   context.contentLength = -1;
   context.status = AppConsoleDownload::HTTP_RESPONSE_BAD_REQUEST;
   context.posFile = 0;
+  context.keepAlive = true;
 
   if (line_ptrs_count < 1) {
     return -1;
@@ -408,6 +881,9 @@ std::int32_t AppConsoleDownload::testResponse(AppConsoleDownload::HttpContext_t
         context.contentLength = length;
       }
     }
+    else if (std::strncmp(line_ptrs[a], "Connection", strlen("Connection")) == 0) {
+      context.keepAlive = (nullptr == std::strstr(line_ptrs[a], "close"));
+    }
   }
   if ((context.status < AppConsoleDownload::HTTP_RESPONSE_OK) \
       || (context.status >= AppConsoleDownload::HTTP_RESPONSE_MULTIPLE_CHOICES)) {
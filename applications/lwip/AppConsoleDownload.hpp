@@ -30,7 +30,7 @@ class AppConsoleDownload final : public Cmd {
   public:
     const char *getComment(void) const noexcept override
     {
-      return "http [-l<size>] [-6] <req> (default is http://test-debit.free.fr/image.iso)";
+      return "http [-l<size>] [-n<count>] [-p<streams>] [-6] <req> (default is http://test-debit.free.fr/image.iso)";
     }
   public:
     const char *getName(void) const noexcept override
@@ -40,18 +40,76 @@ class AppConsoleDownload final : public Cmd {
 
   private:
     typedef struct HttpContext_s {
-      constexpr HttpContext_s(void) : socket(0), status(-1), contentLength(0), posFile(0) {}
+      constexpr HttpContext_s(void) : socket(0), status(-1), contentLength(0), posFile(0), keepAlive(true) {}
       std::int32_t socket;
       std::uint32_t status;
       std::uint64_t contentLength;
       std::uint64_t posFile;
+      bool keepAlive;
     } HttpContext_t;
 
+  private:
+    typedef struct Connection_s {
+      constexpr Connection_s(void) : hostString{'\0'}, port(0U), socket(-1), lastUseInMs(0U) {}
+      char hostString[128];
+      std::uint16_t port;
+      std::int32_t socket;
+      std::uint32_t lastUseInMs;
+    } Connection_t;
+
+  private:
+    typedef struct Stream_s {
+      constexpr Stream_s(void)
+        : socket(-1), offset(0U), remaining(0U), received(0U), startInMs(0U), endInMs(0U) {}
+      std::int32_t socket;
+      std::uint64_t offset;
+      std::uint64_t remaining;
+      std::uint64_t received;
+      std::uint32_t startInMs;
+      std::uint32_t endInMs;
+    } Stream_t;
+
+  private:
+    typedef struct Timing_s {
+      constexpr Timing_s(void) : count(0U), min(UINT32_MAX), max(0U), sum(0U) {}
+      void add(std::uint32_t value) noexcept
+      {
+        this->count++;
+        this->min = (value < this->min) ? value : this->min;
+        this->max = (value > this->max) ? value : this->max;
+        this->sum += value;
+      }
+      std::uint32_t count;
+      std::uint32_t min;
+      std::uint32_t max;
+      std::uint64_t sum;
+    } Timing_t;
+
+  private:
+    void closeConnections(void) noexcept;
+  private:
+    std::int32_t doBenchmark(const char *hostStringPtr, const char *requestStringPtr, std::uint32_t count,
+                             bool useIpv6) noexcept;
   private:
     std::int32_t doDownloadFile(std::int32_t socket, const char *hostPtr, const char *requestPtr) const noexcept;
+  private:
+    std::int32_t doParallelDownload(const char *hostStringPtr, const char *requestStringPtr,
+                                    std::uint32_t streamCount, bool useIpv6) noexcept;
+  private:
+    std::int32_t doRequest(std::int32_t socket, const char *hostStringPtr, const char *requestStringPtr,
+                           bool keepAlive) const noexcept;
+  private:
+    std::int32_t getContentLength(const char *hostStringPtr, const char *requestStringPtr, bool useIpv6,
+                                  std::uint64_t &length) noexcept;
+  private:
+    void giveBackConnection(const char *hostStringPtr, std::uint16_t port, std::int32_t socket) noexcept;
+  private:
+    std::int32_t openConnection(const char *hostStringPtr, std::uint16_t port, bool useIpv6) noexcept;
+  private:
+    void printTiming(const char *nameStringPtr, const AppConsoleDownload::Timing_t &timing) const noexcept;
   private:
     std::int32_t readResponse(std::int32_t sock, unsigned char *headerPtr, std::uint32_t maximumSize,
-                              std::uint32_t &retSize) const noexcept;
+                              std::uint32_t &retSize, std::uint32_t &bodySize) const noexcept;
   private:
     char *seekTo(char *stringPtr, char key) const noexcept;
   private:
@@ -62,6 +120,8 @@ class AppConsoleDownload final : public Cmd {
     std::uint32_t serviceLines(unsigned char *bufferPtr, char *linePtrs[], uint32_t maxLines) const noexcept;
   private:
     void splitHostRequest(const char *urlStringPtr, char * &hostStringPtr, const char * &requestStringPtr) const noexcept;
+  private:
+    std::int32_t takeConnection(const char *hostStringPtr, std::uint16_t port, bool useIpv6, bool &isReused) noexcept;
   private:
     std::int32_t testResponse(AppConsoleDownload::HttpContext_t &context, unsigned char *bufferPtr) const noexcept;
 
@@ -73,6 +133,8 @@ class AppConsoleDownload final : public Cmd {
     static const std::uint32_t DOWNLOAD_LIMITED_SIZE = 140000;
   private:
     static const std::uint32_t HTTP_RESPONSE_OK = 200U;
+  private:
+    static const std::uint32_t HTTP_RESPONSE_PARTIAL_CONTENT = 206U;
   private:
     static const std::uint32_t HTTP_RESPONSE_MULTIPLE_CHOICES = 300U;
   private:
@@ -87,4 +149,11 @@ class AppConsoleDownload final : public Cmd {
     static const std::int32_t TIMEOUT_10S_DEFINED = 10000;
   private:
     static const std::uint32_t TRANSFER_SIZE = 2000U;
+  private:
+    static const std::uint32_t CONNECTION_POOL_SIZE = 2U;
+  private:
+    static const std::uint32_t PARALLEL_STREAM_COUNT_MAX = 8U;
+
+  private:
+    AppConsoleDownload::Connection_t connectionPool[CONNECTION_POOL_SIZE];
 };
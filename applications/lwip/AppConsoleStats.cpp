@@ -17,7 +17,10 @@
   ******************************************************************************
   */
 #include "AppConsoleStats.hpp"
+#include "WiFiNetwork.hpp"
 #include "lwip/stats.h"
+#include "FreeRTOS.h"
+#include "task.h"
 #include <inttypes.h>
 #include <cstdio>
 
@@ -45,6 +48,49 @@ std::int32_t AppConsoleStats::execute(std::int32_t argc, char *argvPtrs[]) noexc
 #if LWIP_STATS && LWIP_STATS_DISPLAY
   stats_display();
 #endif /* LWIP_STATS && LWIP_STATS_DISPLAY */
+  {
+    EmwCoreIpc::PostStatistics_t output_stats;
+
+    WiFiNetwork::GetOutputStatistics(output_stats);
+    (void) std::printf("\nDRIVER OUTPUT\n\tposted: %" PRIu32 "\n\tanswered: %" PRIu32 "\n\tfailed: %" PRIu32 "\n"
+                       "\tlost: %" PRIu32 "\n\twindow full: %" PRIu32 "\n",
+                       output_stats.posted, output_stats.answered, output_stats.failed,
+                       output_stats.lost, output_stats.windowFull);
+  }
+  {
+    WiFiNetwork::Statistics_t network_stats;
+
+    WiFiNetwork::GetStatistics(network_stats);
+    (void) std::printf("\nWIFI NETWORK\n\ttransmit enqueued: %" PRIu32 "\n\ttransmit sent: %" PRIu32 "\n"
+                       "\ttransmit dropped: %" PRIu32 "\n\ttransmit depth max: %" PRIu32 "\n"
+                       "\ttransmit throttled: %" PRIu32 "\n\ttransmit deferred: %" PRIu32 "\n",
+                       network_stats.transmitEnqueued, network_stats.transmitSent, network_stats.transmitDropped,
+                       network_stats.transmitDepthMax, network_stats.transmitThrottled, network_stats.transmitDeferred);
+    {
+      static const char *const class_names[WiFiNetwork::eTRANSMIT_CLASS_COUNT] = {"control", "ack", "bulk"};
+
+      for (std::uint32_t class_index = 0U; class_index < WiFiNetwork::eTRANSMIT_CLASS_COUNT; class_index++) {
+        (void) std::printf("\ttransmit %s enqueued/sent/dropped: %" PRIu32 "/%" PRIu32 "/%" PRIu32 "\n",
+                           class_names[class_index], network_stats.transmitClassEnqueued[class_index],
+                           network_stats.transmitClassSent[class_index],
+                           network_stats.transmitClassDropped[class_index]);
+      }
+    }
+    (void) std::printf("\treceive batches: %" PRIu32 "\n\treceive frames: %" PRIu32 "\n"
+                       "\treceive batch max: %" PRIu32 "\n\treceive dropped: %" PRIu32 "\n"
+                       "\treceive post retries: %" PRIu32 "\n",
+                       network_stats.receiveBatches, network_stats.receiveFrames, network_stats.receiveBatchMax,
+                       network_stats.receiveDropped, network_stats.receivePostRetries);
+  }
+  {
+    TaskHandle_t tcpip_thread = xTaskGetHandle(TCPIP_THREAD_NAME);
+
+    if (nullptr != tcpip_thread) {
+      (void) std::printf("\t%s run time: %" PRIu32 " (%" PRIu32 "%%)\n", TCPIP_THREAD_NAME,
+                         static_cast<std::uint32_t>(ulTaskGetRunTimeCounter(tcpip_thread)),
+                         static_cast<std::uint32_t>(ulTaskGetRunTimePercent(tcpip_thread)));
+    }
+  }
   STD_PRINTF("AppConsoleStats::execute()<\n")
   return 0;
 }
@@ -17,7 +17,9 @@
   ******************************************************************************
   */
 #include "AppWiFiLwip.hpp"
+#include "AppConsoleCpuBench.hpp"
 #include "AppConsoleEcho.hpp"
+#include "AppConsoleIoBench.hpp"
 #include "AppConsoleIperf.hpp"
 #include "AppConsolePing.hpp"
 #include "AppConsoleScan.hpp"
@@ -106,8 +108,6 @@ extern "C" {
     (void) std::printf("\nWi-Fi network interface initialization (STATION)\n");
     the_application.constructStationNetworkInterface();
 
-    WiFiNetwork::CheckIoSpeed();
-
     {
       static const char ssid[33] = {"MyHotSpot"};
       static const char psk[65] = {""};
@@ -138,13 +138,15 @@ extern "C" {
       }
 
       {
+        class AppConsoleCpuBench cpubench;
         class AppConsoleEcho echo;
         class AppConsoleDownload http;
+        class AppConsoleIoBench iobench(WiFiNetwork::GetDriver());
         class AppConsoleIperf iperf(the_application.netifSTA);
         class AppConsolePing ping(the_application.netifSTA);
         class AppConsoleScan scan;
         class AppConsoleStats stats;
-        class Cmd *cmds[] = {&echo, &http, &iperf, &ping, &scan, &stats, nullptr};
+        class Cmd *cmds[] = {&cpubench, &echo, &http, &iobench, &iperf, &ping, &scan, &stats, nullptr};
 
         class Console the_console("app>", cmds);
 
@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "LwipChecksum.hpp"
+#include "lwip/def.h"
+#include <cstdint>
+
+
+/* The 16-bit words are added in memory order, the sum is byte swapped at the end when the data start
+ * on an odd address, as the words are then shifted by one byte.
+ * The bulk is read 4 words at a time from an aligned address, each one added as two halves:
+ * with the DSP extension of the Cortex-M33 this is one UXTAH and one ADD with shift per word,
+ * and the 32-bit sum cannot overflow for a length of lwIP (16-bit).
+ */
+extern "C" std::uint16_t LwipChecksum(const void *dataPtr, int length)
+{
+  const std::uint8_t *byte_ptr = static_cast<const std::uint8_t *>(dataPtr);
+  const bool is_odd = (0U != (reinterpret_cast<std::uintptr_t>(byte_ptr) & 1U));
+  std::uint32_t sum = 0U;
+  std::uint16_t last = 0U;
+
+  if (is_odd && (0 < length)) {
+    reinterpret_cast<std::uint8_t *>(&last)[1] = *byte_ptr++;
+    length--;
+  }
+  if ((0U != (reinterpret_cast<std::uintptr_t>(byte_ptr) & 2U)) && (1 < length)) {
+    sum += *reinterpret_cast<const std::uint16_t *>(byte_ptr);
+    byte_ptr += 2;
+    length -= 2;
+  }
+  {
+    const std::uint32_t *word_ptr = reinterpret_cast<const std::uint32_t *>(byte_ptr);
+
+    while (15 < length) {
+      const std::uint32_t word0 = word_ptr[0];
+      const std::uint32_t word1 = word_ptr[1];
+      const std::uint32_t word2 = word_ptr[2];
+      const std::uint32_t word3 = word_ptr[3];
+
+      sum += static_cast<std::uint16_t>(word0);
+      sum += word0 >> 16;
+      sum += static_cast<std::uint16_t>(word1);
+      sum += word1 >> 16;
+      sum += static_cast<std::uint16_t>(word2);
+      sum += word2 >> 16;
+      sum += static_cast<std::uint16_t>(word3);
+      sum += word3 >> 16;
+      word_ptr += 4;
+      length -= 16;
+    }
+    while (3 < length) {
+      const std::uint32_t word = *word_ptr++;
+
+      sum += static_cast<std::uint16_t>(word);
+      sum += word >> 16;
+      length -= 4;
+    }
+    byte_ptr = reinterpret_cast<const std::uint8_t *>(word_ptr);
+  }
+  if (1 < length) {
+    sum += *reinterpret_cast<const std::uint16_t *>(byte_ptr);
+    byte_ptr += 2;
+    length -= 2;
+  }
+  if (0 < length) {
+    reinterpret_cast<std::uint8_t *>(&last)[0] = *byte_ptr;
+  }
+  sum += last;
+  sum = (sum & 0xFFFFU) + (sum >> 16);
+  sum = (sum & 0xFFFFU) + (sum >> 16);
+  if (is_odd) {
+    sum = ((sum & 0xFFU) << 8) | ((sum & 0xFF00U) >> 8);
+  }
+  return static_cast<std::uint16_t>(sum);
+}
+
+/* RFC 1071 over the bytes taken by pairs in network order, independent of the alignment and of the endianness. */
+extern "C" std::uint16_t LwipChecksumReference(const void *dataPtr, int length)
+{
+  const std::uint8_t *byte_ptr = static_cast<const std::uint8_t *>(dataPtr);
+  std::uint32_t sum = 0U;
+
+  while (1 < length) {
+    sum += (static_cast<std::uint32_t>(byte_ptr[0]) << 8) | byte_ptr[1];
+    byte_ptr += 2;
+    length -= 2;
+  }
+  if (0 < length) {
+    sum += static_cast<std::uint32_t>(byte_ptr[0]) << 8;
+  }
+  while (0U != (sum >> 16)) {
+    sum = (sum & 0xFFFFU) + (sum >> 16);
+  }
+  /* lwIP keeps the checksums in the order of the memory. */
+  return lwip_htons(static_cast<std::uint16_t>(sum));
+}
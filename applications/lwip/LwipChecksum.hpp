@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include <cstdint>
+
+/* Internet checksums of lwIP (RFC 1071), same result as lwip_standard_chksum().
+ * LwipChecksum() is the one of the stack (LWIP_CHKSUM in lwipopts.h), it sums 32-bit words.
+ * LwipChecksumReference() is the portable byte per byte version, kept to check the other one.
+ * lwip_standard_chksum() is still built (LWIP_CHKSUM_ALGORITHM in lwipopts.h), lwIP declares it only when
+ * LWIP_CHKSUM is not set.
+ */
+extern "C" std::uint16_t LwipChecksum(const void *dataPtr, int length);
+extern "C" std::uint16_t LwipChecksumReference(const void *dataPtr, int length);
+extern "C" std::uint16_t lwip_standard_chksum(const void *dataptr, int len);
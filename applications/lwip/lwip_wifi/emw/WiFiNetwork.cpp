@@ -23,13 +23,20 @@
 #include "lwip/dhcp.h"
 #include "lwip/etharp.h"
 #include "lwip/ethip6.h"
+#include "lwip/prot/iana.h"
+#include "lwip/prot/ip.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/ip6.h"
+#include "lwip/prot/tcp.h"
+#include "lwip/prot/udp.h"
 #include "lwip/sockets.h"
 #include "lwip/sys.h"
+#include "lwip/tcpip.h"
+#include "netif/ethernet.h"
 #include "stm32u5xx_hal.h"
 #include <cinttypes>
 #include <cstdio>
 #include <cstring>
-#include <memory>
 
 //#define STD_PRINTF(...) (void) std::printf(__VA_ARGS__);
 #define STD_PRINTF(...)
@@ -102,12 +109,17 @@ std::int32_t WiFiNetwork::startDriver(void) noexcept
     STD_PRINTF("[%6" PRIu32 "] WiFiNetwork::startDriver(): REBOOT(HW) ...\n", HAL_GetTick())
     (void) WiFiNetwork::Driver.resetHardware();
 
-    if (static_cast<err_t>(ERR_OK) == sys_mbox_new(&WiFiNetwork::TransmitFifo, 8U)) {
-      static const char transmit_fifo_name[] = {"WiFiNetwork::FIFO"};
-      vQueueAddToRegistry(static_cast<QueueHandle_t>(WiFiNetwork::TransmitFifo.mbx), transmit_fifo_name);
+    for (sys_mbox_t &transmit_fifo : WiFiNetwork::TransmitFifos) {
+      if (static_cast<err_t>(ERR_OK) == sys_mbox_new(&transmit_fifo, WiFiNetwork::TRANSMIT_QUEUE_SIZE)) {
+        static const char transmit_fifo_name[] = {"WiFiNetwork::FIFO"};
+        vQueueAddToRegistry(static_cast<QueueHandle_t>(transmit_fifo.mbx), transmit_fifo_name);
+      }
+      else {
+        LWIP_ASSERT("Creation of the transmit FIFO for the Wi-Fi device failed", false);
+      }
     }
-    else {
-      LWIP_ASSERT("Creation of the transmit FIFO for the Wi-Fi device failed", false);
+    if (static_cast<err_t>(ERR_OK) != sys_sem_new(&WiFiNetwork::TransmitSem, 0U)) {
+      LWIP_ASSERT("Creation of the transmit semaphore for the Wi-Fi device failed", false);
     }
     {
       static const char transmit_fifo_thread_name[] = {"NETIF-SendThread"};
@@ -306,7 +318,18 @@ void WiFiNetwork::unInitializeNetif(void) noexcept
   this->unInitializeDriver();
   if (0U == WiFiNetwork::Driver.numberOfInterfacesRunning()) {
     WiFiNetwork::DeleteTransmitFifo();
-    sys_mbox_free(&this->TransmitFifo);
+    for (sys_mbox_t &transmit_fifo : WiFiNetwork::TransmitFifos) {
+      void *message_ptr = nullptr;
+
+      while (SYS_MBOX_EMPTY != sys_arch_mbox_tryfetch(&transmit_fifo, &message_ptr)) {
+        (void) pbuf_free(static_cast<struct pbuf *>(message_ptr));
+      }
+      sys_mbox_free(&transmit_fifo);
+    }
+    sys_sem_free(&WiFiNetwork::TransmitSem);
+    WiFiNetwork::TransmitQueueLevel = 0U;
+    WiFiNetwork::TransmitQueueThrottled = false;
+    WiFiNetwork::TransmitPriorityRun = 0U;
   }
   STD_PRINTF("WiFiNetwork::unInitializeNetif()<\n")
 }
@@ -413,10 +436,7 @@ void WiFiNetwork::InputNetif(struct netif &networkInterface, EmwNetworkStack::Bu
           std::printf("<\n");
         }
 #endif /* ENABLE_DEBUG */
-        if (static_cast<err_t>(ERR_OK) != networkInterface.input(bufferPtr, &networkInterface)) {
-          LWIP_DEBUGF(NETIF_DEBUG | LWIP_DBG_TRACE, ("WiFiNetwork::inputNetif(): networkInterface->input() failed\n"));
-          (void) pbuf_free(bufferPtr);
-        }
+        WiFiNetwork::QueueInput(networkInterface, bufferPtr);
         break;
       }
     case ETHTYPE_JUMBO:
@@ -435,53 +455,139 @@ void WiFiNetwork::InputNetif(struct netif &networkInterface, EmwNetworkStack::Bu
   EMW_STATS_INCREMENT(free)
 }
 
+/* Runs in the tcpip thread, it inputs all the frames queued since it was posted. */
+void WiFiNetwork::InputBatchInTcpip(void *argumentPtr) noexcept
+{
+  std::uint32_t batch_count = 0U;
+
+  static_cast<void>(argumentPtr);
+
+  for (;;) {
+    WiFiNetwork::ReceivedFrame_t frame = {nullptr, nullptr};
+    SYS_ARCH_DECL_PROTECT(old_level);
+
+    SYS_ARCH_PROTECT(old_level);
+    if (0U == WiFiNetwork::ReceiveBatchCount) {
+      WiFiNetwork::ReceiveBatchPending = false;
+    }
+    else {
+      frame = WiFiNetwork::ReceiveBatch[WiFiNetwork::ReceiveBatchReadIndex];
+      WiFiNetwork::ReceiveBatchReadIndex = (WiFiNetwork::ReceiveBatchReadIndex + 1U) \
+                                           % WiFiNetwork::RECEIVE_BATCH_COUNT_MAX;
+      WiFiNetwork::ReceiveBatchCount--;
+    }
+    SYS_ARCH_UNPROTECT(old_level);
+
+    if (nullptr == frame.bufferPtr) {
+      break;
+    }
+    if (static_cast<err_t>(ERR_OK) != ethernet_input(frame.bufferPtr, frame.netifPtr)) {
+      LWIP_DEBUGF(NETIF_DEBUG | LWIP_DBG_TRACE, ("WiFiNetwork::InputBatchInTcpip(): ethernet_input() failed\n"));
+      (void) pbuf_free(frame.bufferPtr);
+    }
+    batch_count++;
+  }
+  WiFiNetwork::Statistics.receiveBatches++;
+  WiFiNetwork::Statistics.receiveFrames += batch_count;
+  if (WiFiNetwork::Statistics.receiveBatchMax < batch_count) {
+    WiFiNetwork::Statistics.receiveBatchMax = batch_count;
+  }
+}
+
+/* Queues the frame for the tcpip thread, only the first frame of a batch posts a message to it. */
+void WiFiNetwork::QueueInput(struct netif &networkInterface, struct pbuf *bufferPtr) noexcept
+{
+  bool is_queued = false;
+  bool must_post = false;
+  SYS_ARCH_DECL_PROTECT(old_level);
+
+  SYS_ARCH_PROTECT(old_level);
+  if (WiFiNetwork::RECEIVE_BATCH_COUNT_MAX > WiFiNetwork::ReceiveBatchCount) {
+    const std::uint32_t index = (WiFiNetwork::ReceiveBatchReadIndex + WiFiNetwork::ReceiveBatchCount) \
+                                % WiFiNetwork::RECEIVE_BATCH_COUNT_MAX;
+
+    WiFiNetwork::ReceiveBatch[index].bufferPtr = bufferPtr;
+    WiFiNetwork::ReceiveBatch[index].netifPtr = &networkInterface;
+    WiFiNetwork::ReceiveBatchCount++;
+    must_post = !WiFiNetwork::ReceiveBatchPending;
+    WiFiNetwork::ReceiveBatchPending = true;
+    is_queued = true;
+  }
+  SYS_ARCH_UNPROTECT(old_level);
+
+  if (!is_queued) {
+    LWIP_DEBUGF(NETIF_DEBUG | LWIP_DBG_TRACE, ("WiFiNetwork::QueueInput(): batch full\n"));
+    WiFiNetwork::Statistics.receiveDropped++;
+    (void) pbuf_free(bufferPtr);
+  }
+  else if (must_post) {
+    /* The tcpip mailbox is full, the receive thread waits for it to drain and posts again,
+     * the queued frames would be stranded if the batch had no pending callback. */
+    while (static_cast<err_t>(ERR_OK) != tcpip_try_callback(WiFiNetwork::InputBatchInTcpip, nullptr)) {
+      WiFiNetwork::Statistics.receivePostRetries++;
+      sys_msleep(WiFiNetwork::RECEIVE_POST_RETRY_DELAY_MS);
+    }
+  }
+}
+
 err_t WiFiNetwork::OutputToDriver(struct netif *netifPtr, struct pbuf *bufferPtr) noexcept
 {
   err_t status = static_cast<err_t>(ERR_ARG);
 
   if ((nullptr != netifPtr) && (nullptr != netifPtr->state) && (nullptr != bufferPtr)) {
     const class WiFiNetwork *const wifi_network_ptr = WiFiNetwork::MySelf(netifPtr);
+    const WiFiNetwork::TransmitClass transmit_class = WiFiNetwork::ClassifyFrame(*bufferPtr);
 
-    pbuf_ref(bufferPtr);
-    LWIP_DEBUGF(NETIF_DEBUG | LWIP_DBG_TRACE,
-                ("WiFiNetwork::OutputToDriver(): Transmit buffer %p next=%p  tot_len=%" PRIu32 " len=%" PRIu32 "\n",
-                 static_cast<const void *>(bufferPtr), static_cast<const void *>(bufferPtr->next),
-                 static_cast<std::uint32_t>(bufferPtr->tot_len), static_cast<std::uint32_t>(bufferPtr->len)));
+    if ((WiFiNetwork::eTRANSMIT_CLASS_BULK == transmit_class) && WiFiNetwork::TransmitQueueThrottled) {
+      /* Above the high watermark, lwIP keeps the bulk frame until the queue is back to the low watermark.
+       * The control frames and the pure acknowledgements are still admitted. */
+      SYS_ARCH_DECL_PROTECT(old_level);
 
-    if (wifi_network_ptr->driverInterface == EmwApiBase::eSTATION) {
-      bufferPtr->if_idx = static_cast<std::uint8_t>(EmwApiBase::eWIFI_INTERFACE_STATION_IDX);
+      SYS_ARCH_PROTECT(old_level);
+      WiFiNetwork::Statistics.transmitDeferred++;
+      SYS_ARCH_UNPROTECT(old_level);
+      status = static_cast<err_t>(ERR_MEM);
     }
     else {
-      bufferPtr->if_idx = static_cast<std::uint8_t>(EmwApiBase::eWIFI_INTERFACE_SOFTAP_IDX);
-    }
-    if ((nullptr != bufferPtr->next) || (bufferPtr->tot_len != bufferPtr->len)) {
-      struct pbuf *buf_send_ptr = pbuf_clone(PBUF_RAW, PBUF_RAM, bufferPtr);
-
-      (void) pbuf_free(bufferPtr);
-      if (nullptr == buf_send_ptr) {
-        LWIP_DEBUGF(NETIF_DEBUG | LWIP_DBG_TRACE,
-                    ("WiFiNetwork::OutputToDriver(): No memory for chained buffer!!!"));
-        status = static_cast<err_t>(ERR_MEM);
+      pbuf_ref(bufferPtr);
+      LWIP_DEBUGF(NETIF_DEBUG | LWIP_DBG_TRACE,
+                  ("WiFiNetwork::OutputToDriver(): Transmit buffer %p next=%p  tot_len=%" PRIu32 " len=%" PRIu32 "\n",
+                   static_cast<const void *>(bufferPtr), static_cast<const void *>(bufferPtr->next),
+                   static_cast<std::uint32_t>(bufferPtr->tot_len), static_cast<std::uint32_t>(bufferPtr->len)));
+
+      if (wifi_network_ptr->driverInterface == EmwApiBase::eSTATION) {
+        bufferPtr->if_idx = static_cast<std::uint8_t>(EmwApiBase::eWIFI_INTERFACE_STATION_IDX);
       }
       else {
-        (void) sys_mbox_post(&WiFiNetwork::TransmitFifo, buf_send_ptr);
-        status = static_cast<err_t>(ERR_OK);
+        bufferPtr->if_idx = static_cast<std::uint8_t>(EmwApiBase::eWIFI_INTERFACE_SOFTAP_IDX);
+      }
+      if ((nullptr != bufferPtr->next) || (bufferPtr->tot_len != bufferPtr->len)) {
+        struct pbuf *buf_send_ptr = pbuf_clone(PBUF_RAW, PBUF_RAM, bufferPtr);
 
+        (void) pbuf_free(bufferPtr);
+        if (nullptr == buf_send_ptr) {
+          LWIP_DEBUGF(NETIF_DEBUG | LWIP_DBG_TRACE,
+                      ("WiFiNetwork::OutputToDriver(): No memory for chained buffer!!!"));
+          status = static_cast<err_t>(ERR_MEM);
+        }
+        else {
 #if defined(ENABLE_DEBUG)
-        {
-          std::printf(">\n");
-          for (std::uint32_t i = 0U; i < buf_send_ptr->tot_len; i++) {
-            const std::uint8_t tx_data = (static_cast<std::uint8_t *>(buf_send_ptr->payload))[i];
-            std::printf("%x", tx_data);
+          {
+            std::printf(">\n");
+            for (std::uint32_t i = 0U; i < buf_send_ptr->tot_len; i++) {
+              const std::uint8_t tx_data = (static_cast<std::uint8_t *>(buf_send_ptr->payload))[i];
+              std::printf("%x", tx_data);
+            }
+            std::printf("<\n");
           }
-          std::printf("<\n");
-        }
 #endif /* ENABLE_DEBUG */
+          /* The buffer belongs to the transmit queue from now on, it may be freed at once. */
+          status = WiFiNetwork::QueueOutput(buf_send_ptr, transmit_class);
+        }
+      }
+      else {
+        status = WiFiNetwork::QueueOutput(bufferPtr, transmit_class);
       }
-    }
-    else {
-      sys_mbox_post(&WiFiNetwork::TransmitFifo, bufferPtr);
-      status = static_cast<err_t>(ERR_OK);
     }
   }
   else {
@@ -490,20 +596,178 @@ err_t WiFiNetwork::OutputToDriver(struct netif *netifPtr, struct pbuf *bufferPtr
   return status;
 }
 
-void WiFiNetwork::PushToDriver(std::uint32_t timeoutInMs) noexcept
+/* Only the headers of the first buffer are looked at, lwIP builds them in one piece.
+ * A fragment or a truncated header falls in the bulk class.
+ */
+WiFiNetwork::TransmitClass WiFiNetwork::ClassifyFrame(const struct pbuf &buffer) noexcept
 {
+  WiFiNetwork::TransmitClass transmit_class = WiFiNetwork::eTRANSMIT_CLASS_BULK;
+  const std::uint8_t *const frame_ptr = static_cast<const std::uint8_t *>(buffer.payload);
+  const std::uint32_t frame_length = static_cast<std::uint32_t>(buffer.len);
+
+  if (SIZEOF_ETH_HDR <= frame_length) {
+    const struct eth_hdr *const eth_header_ptr = reinterpret_cast<const struct eth_hdr *>(frame_ptr);
+    const std::uint16_t ether_type = lwip_ntohs(eth_header_ptr->type);
+    const std::uint8_t *const packet_ptr = &frame_ptr[SIZEOF_ETH_HDR];
+    const std::uint32_t packet_length = frame_length - SIZEOF_ETH_HDR;
+    std::uint32_t protocol = 0U;
+    std::uint32_t header_length = 0U;
+    std::uint32_t payload_length = 0U;
+
+    if (static_cast<std::uint16_t>(ETHTYPE_ARP) == ether_type) {
+      transmit_class = WiFiNetwork::eTRANSMIT_CLASS_CONTROL;
+    }
+    else if ((static_cast<std::uint16_t>(ETHTYPE_IP) == ether_type) && (IP_HLEN <= packet_length)) {
+      const struct ip_hdr *const ip_header_ptr = reinterpret_cast<const struct ip_hdr *>(packet_ptr);
+
+      if (0U == (lwip_ntohs(IPH_OFFSET(ip_header_ptr)) & (IP_MF | IP_OFFMASK))) {
+        protocol = IPH_PROTO(ip_header_ptr);
+        header_length = IPH_HL_BYTES(ip_header_ptr);
+        payload_length = lwip_ntohs(IPH_LEN(ip_header_ptr));
+        payload_length = (payload_length > header_length) ? (payload_length - header_length) : 0U;
+      }
+    }
+    else if ((static_cast<std::uint16_t>(ETHTYPE_IPV6) == ether_type) && (IP6_HLEN <= packet_length)) {
+      const struct ip6_hdr *const ip6_header_ptr = reinterpret_cast<const struct ip6_hdr *>(packet_ptr);
+
+      /* The extension headers are not followed. */
+      protocol = IP6H_NEXTH(ip6_header_ptr);
+      header_length = IP6_HLEN;
+      payload_length = IP6H_PLEN(ip6_header_ptr);
+    }
+    if ((IP_PROTO_ICMP == protocol) || (IP6_NEXTH_ICMP6 == protocol)) {
+      transmit_class = WiFiNetwork::eTRANSMIT_CLASS_CONTROL;
+    }
+    else if ((IP_PROTO_TCP == protocol) && ((header_length + TCP_HLEN) <= packet_length)) {
+      const struct tcp_hdr *const tcp_header_ptr = reinterpret_cast<const struct tcp_hdr *>(&packet_ptr[header_length]);
+
+      const std::uint8_t tcp_flags = TCPH_FLAGS(tcp_header_ptr);
+
+      /* Only a pure acknowledgement, a segment without data nor SYN, FIN or RST. */
+      if ((payload_length <= TCPH_HDRLEN_BYTES(tcp_header_ptr)) && (0U != (tcp_flags & TCP_ACK)) \
+          && (0U == (tcp_flags & (TCP_SYN | TCP_FIN | TCP_RST)))) {
+        transmit_class = WiFiNetwork::eTRANSMIT_CLASS_ACK;
+      }
+    }
+    else if ((IP_PROTO_UDP == protocol) && ((header_length + UDP_HLEN) <= packet_length)) {
+      const struct udp_hdr *const udp_header_ptr = reinterpret_cast<const struct udp_hdr *>(&packet_ptr[header_length]);
+      const std::uint16_t port = lwip_ntohs(udp_header_ptr->dest);
+
+      if ((static_cast<std::uint16_t>(LWIP_IANA_PORT_DHCP_SERVER) == port) \
+          || (static_cast<std::uint16_t>(LWIP_IANA_PORT_DHCP_CLIENT) == port) \
+          || (WiFiNetwork::DHCP6_SERVER_PORT == port) || (WiFiNetwork::DHCP6_CLIENT_PORT == port) \
+          || (WiFiNetwork::DNS_SERVER_PORT == port)) {
+        transmit_class = WiFiNetwork::eTRANSMIT_CLASS_CONTROL;
+      }
+    }
+  }
+  return transmit_class;
+}
+
+/* Never blocks the caller, a frame that does not fit is dropped and reported to lwIP. */
+err_t WiFiNetwork::QueueOutput(struct pbuf *bufferPtr, WiFiNetwork::TransmitClass transmitClass) noexcept
+{
+  err_t status = static_cast<err_t>(ERR_MEM);
+  SYS_ARCH_DECL_PROTECT(old_level);
+
+  /* The level is counted before the post, so that the transmit thread never sees it lower than the queues. */
+  SYS_ARCH_PROTECT(old_level);
+  WiFiNetwork::TransmitQueueLevel++;
+  SYS_ARCH_UNPROTECT(old_level);
+
+  if (static_cast<err_t>(ERR_OK) == sys_mbox_trypost(&WiFiNetwork::TransmitFifos[transmitClass], bufferPtr)) {
+    SYS_ARCH_PROTECT(old_level);
+    WiFiNetwork::Statistics.transmitEnqueued++;
+    WiFiNetwork::Statistics.transmitClassEnqueued[transmitClass]++;
+    if (WiFiNetwork::Statistics.transmitDepthMax < WiFiNetwork::TransmitQueueLevel) {
+      WiFiNetwork::Statistics.transmitDepthMax = WiFiNetwork::TransmitQueueLevel;
+    }
+    if ((!WiFiNetwork::TransmitQueueThrottled) \
+        && (WiFiNetwork::TRANSMIT_QUEUE_HIGH_WATERMARK <= WiFiNetwork::TransmitQueueLevel)) {
+      WiFiNetwork::TransmitQueueThrottled = true;
+      WiFiNetwork::Statistics.transmitThrottled++;
+    }
+    SYS_ARCH_UNPROTECT(old_level);
+    sys_sem_signal(&WiFiNetwork::TransmitSem);
+    status = static_cast<err_t>(ERR_OK);
+  }
+  else {
+    SYS_ARCH_PROTECT(old_level);
+    WiFiNetwork::TransmitQueueLevel--;
+    WiFiNetwork::Statistics.transmitDropped++;
+    WiFiNetwork::Statistics.transmitClassDropped[transmitClass]++;
+    SYS_ARCH_UNPROTECT(old_level);
+    (void) pbuf_free(bufferPtr);
+  }
+  return status;
+}
+
+/* Strict priority, the first class with a frame wins.
+ * After TRANSMIT_PRIORITY_RUN_MAX frames in a row of the higher classes, the bulk class is looked at first,
+ * so that a stream of acknowledgements cannot starve the bulk data. Only called by the transmit thread. */
+struct pbuf *WiFiNetwork::DequeueOutput(WiFiNetwork::TransmitClass &transmitClass) noexcept
+{
+  struct pbuf *packet_ptr = nullptr;
   void *message_ptr = nullptr;
 
-  if (SYS_ARCH_TIMEOUT != sys_arch_mbox_fetch(&WiFiNetwork::TransmitFifo, &message_ptr, timeoutInMs)) {
-    if (nullptr != message_ptr) {
-      struct pbuf *const packet_ptr = static_cast<struct pbuf *>(message_ptr);
-      const EmwApiBase::Status ret = WiFiNetwork::Driver.output(static_cast<std::uint8_t*>(packet_ptr->payload),
-                                     static_cast<std::int32_t>(packet_ptr->len),
-                                     static_cast<std::int32_t>(packet_ptr->if_idx));
+  if ((WiFiNetwork::TRANSMIT_PRIORITY_RUN_MAX <= WiFiNetwork::TransmitPriorityRun) \
+      && (SYS_MBOX_EMPTY != sys_arch_mbox_tryfetch(&WiFiNetwork::TransmitFifos[WiFiNetwork::eTRANSMIT_CLASS_BULK],
+                                                   &message_ptr))) {
+    packet_ptr = static_cast<struct pbuf *>(message_ptr);
+    transmitClass = WiFiNetwork::eTRANSMIT_CLASS_BULK;
+  }
+  for (std::uint32_t class_index = 0U;
+       (nullptr == packet_ptr) && (class_index < WiFiNetwork::eTRANSMIT_CLASS_COUNT); class_index++) {
+    if (SYS_MBOX_EMPTY != sys_arch_mbox_tryfetch(&WiFiNetwork::TransmitFifos[class_index], &message_ptr)) {
+      packet_ptr = static_cast<struct pbuf *>(message_ptr);
+      transmitClass = static_cast<WiFiNetwork::TransmitClass>(class_index);
+    }
+  }
+  if (nullptr != packet_ptr) {
+    if (WiFiNetwork::eTRANSMIT_CLASS_BULK == transmitClass) {
+      WiFiNetwork::TransmitPriorityRun = 0U;
+    }
+    else {
+      WiFiNetwork::TransmitPriorityRun++;
+    }
+  }
+  return packet_ptr;
+}
+
+void WiFiNetwork::PushToDriver(std::uint32_t timeoutInMs) noexcept
+{
+  WiFiNetwork::TransmitClass transmit_class = WiFiNetwork::eTRANSMIT_CLASS_BULK;
+  struct pbuf *packet_ptr = WiFiNetwork::DequeueOutput(transmit_class);
 
-      LWIP_ASSERT("Driver.output() failed", EmwApiBase::eEMW_STATUS_OK == ret);
-      (void) pbuf_free(packet_ptr);
+  if ((nullptr == packet_ptr) && (SYS_ARCH_TIMEOUT != sys_arch_sem_wait(&WiFiNetwork::TransmitSem, timeoutInMs))) {
+    packet_ptr = WiFiNetwork::DequeueOutput(transmit_class);
+  }
+  if (nullptr != packet_ptr) {
+    /* One bypass command per frame, the module firmware takes a single frame per command.
+     * The classes are looked at again on the next call, so that an acknowledgement overtakes the bulk data. */
+    const EmwApiBase::Status ret = WiFiNetwork::Driver.output(static_cast<std::uint8_t*>(packet_ptr->payload),
+                                   static_cast<std::int32_t>(packet_ptr->len),
+                                   static_cast<std::int32_t>(packet_ptr->if_idx));
+    SYS_ARCH_DECL_PROTECT(old_level);
+
+    (void) pbuf_free(packet_ptr);
+    SYS_ARCH_PROTECT(old_level);
+    WiFiNetwork::TransmitQueueLevel--;
+    if (WiFiNetwork::TransmitQueueThrottled \
+        && (WiFiNetwork::TRANSMIT_QUEUE_LOW_WATERMARK >= WiFiNetwork::TransmitQueueLevel)) {
+      WiFiNetwork::TransmitQueueThrottled = false;
+    }
+    if (EmwApiBase::eEMW_STATUS_OK == ret) {
+      WiFiNetwork::Statistics.transmitSent++;
+      WiFiNetwork::Statistics.transmitClassSent[transmit_class]++;
+    }
+    else {
+      WiFiNetwork::Statistics.transmitDropped++;
+      WiFiNetwork::Statistics.transmitClassDropped[transmit_class]++;
     }
+    SYS_ARCH_UNPROTECT(old_level);
+    LWIP_DEBUGF(NETIF_DEBUG | LWIP_DBG_TRACE, ("WiFiNetwork::PushToDriver(): %" PRIi32 "\n",
+                static_cast<std::int32_t>(ret)));
   }
 }
 
@@ -598,45 +862,19 @@ void WiFiNetwork::NetifStatusCallback(struct netif *netifPtr) noexcept
   }
 }
 
-void WiFiNetwork::CheckIoSpeed(void) noexcept
+void WiFiNetwork::GetOutputStatistics(EmwCoreIpc::PostStatistics_t &statistics) noexcept
 {
-  const std::uint16_t ipc_test_data_size = EmwNetworkStack::NETWORK_BUFFER_SIZE;
-  std::unique_ptr<std::uint8_t[], decltype(&vPortFree)> \
-  ipc_test_data_ptr(static_cast<std::uint8_t*>(pvPortMalloc(ipc_test_data_size)), &vPortFree);
-
-  if (nullptr != ipc_test_data_ptr) {
-    std::uint32_t send_count = 0U;
-    std::uint32_t receive_count = 0U;
-    std::uint32_t time_ms_count;
-
-    std::memset(&ipc_test_data_ptr[0], 0x00, ipc_test_data_size);
-
-    (void) std::printf("\nWiFiNetwork::CheckIoSpeed()> (130 x (%" PRIu32 " + %" PRIu32 ")) ...\n",
-                       static_cast<std::uint32_t>(ipc_test_data_size), static_cast<std::uint32_t>(ipc_test_data_size));
-    time_ms_count = HAL_GetTick();
-
-    for (std::uint32_t i = 0U; i < 130U; i++) {
-      std::uint16_t echoed_length = ipc_test_data_size;
-      const EmwApiBase::Status status \
-        = WiFiNetwork::Driver.testIpcEcho(reinterpret_cast<std::uint8_t (&)[]>(* &ipc_test_data_ptr[0]), ipc_test_data_size,
-                                          reinterpret_cast<std::uint8_t (&)[]>(* &ipc_test_data_ptr[0]), echoed_length, 5000U);
-      if (EmwApiBase::eEMW_STATUS_OK != status) {
-        (void) std::printf("Failed to call testIpcEcho() (%" PRId32 ")\n", static_cast<std::int32_t>(status));
-        return;
-      }
-      else {
-        send_count += ipc_test_data_size;
-        receive_count += echoed_length;
-      }
-    }
-    time_ms_count = HAL_GetTick() - time_ms_count;
-    if (0 != time_ms_count) {
-      const std::uint32_t total_sent_and_received = send_count + receive_count;
-      const std::uint32_t speed = (8 * total_sent_and_received) / time_ms_count;
-      (void) std::printf("transferred: %" PRIu32 " bytes, time: %" PRIu32 " ms, Speed: %" PRIu32 " Kbps\n",
-                         total_sent_and_received, time_ms_count, speed);
-    }
-  }
+  WiFiNetwork::Driver.getOutputStatistics(statistics);
+}
+
+void WiFiNetwork::GetStatistics(WiFiNetwork::Statistics_t &statistics) noexcept
+{
+  statistics = WiFiNetwork::Statistics;
+}
+
+class EmwApiCore &WiFiNetwork::GetDriver(void) noexcept
+{
+  return WiFiNetwork::Driver;
 }
 
 class WiFiNetwork *WiFiNetwork::MySelf(struct netif *netifPtr) noexcept {
@@ -728,7 +966,16 @@ void WiFiNetwork::NetifExtCallbackFunction(struct netif *netifPtr, netif_nsc_rea
 }
 
 class EmwApiEmwBypass WiFiNetwork::Driver;
-sys_mbox_t WiFiNetwork::TransmitFifo = {nullptr};
+sys_mbox_t WiFiNetwork::TransmitFifos[WiFiNetwork::eTRANSMIT_CLASS_COUNT] = {{nullptr}, {nullptr}, {nullptr}};
+sys_sem_t WiFiNetwork::TransmitSem = {nullptr};
+WiFiNetwork::Statistics_t WiFiNetwork::Statistics;
+std::uint32_t WiFiNetwork::TransmitQueueLevel = 0U;
+volatile bool WiFiNetwork::TransmitQueueThrottled = false;
+std::uint32_t WiFiNetwork::TransmitPriorityRun = 0U;
+WiFiNetwork::ReceivedFrame_t WiFiNetwork::ReceiveBatch[WiFiNetwork::RECEIVE_BATCH_COUNT_MAX];
+std::uint32_t WiFiNetwork::ReceiveBatchReadIndex = 0U;
+std::uint32_t WiFiNetwork::ReceiveBatchCount = 0U;
+bool WiFiNetwork::ReceiveBatchPending = false;
 volatile bool WiFiNetwork::TransmitThreadQuitFlag;
 class WiFiNetwork *WiFiNetwork::WiFiNetworks[EmwApiBase::eWIFI_INTERFACE_COUNT_MAX] = { nullptr, nullptr };
 
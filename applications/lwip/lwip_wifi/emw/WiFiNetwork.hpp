@@ -26,6 +26,38 @@
 #include <cstdint>
 
 class WiFiNetwork final {
+  public:
+    /* Transmit classes, in decreasing order of priority. */
+    enum /*class*/ TransmitClass : std::uint32_t {
+      eTRANSMIT_CLASS_CONTROL = 0,
+      eTRANSMIT_CLASS_ACK = 1,
+      eTRANSMIT_CLASS_BULK = 2,
+      eTRANSMIT_CLASS_COUNT = 3
+    };
+
+  public:
+    typedef struct Statistics_s {
+      constexpr Statistics_s(void) noexcept
+        : transmitEnqueued(0U), transmitSent(0U), transmitDropped(0U), transmitDepthMax(0U), transmitThrottled(0U)
+        , transmitDeferred(0U)
+        , transmitClassEnqueued{0U, 0U, 0U}, transmitClassSent{0U, 0U, 0U}, transmitClassDropped{0U, 0U, 0U}
+        , receiveBatches(0U), receiveFrames(0U), receiveBatchMax(0U), receiveDropped(0U), receivePostRetries(0U) {}
+      std::uint32_t transmitEnqueued;
+      std::uint32_t transmitSent;
+      std::uint32_t transmitDropped;
+      std::uint32_t transmitDepthMax;
+      std::uint32_t transmitThrottled;
+      std::uint32_t transmitDeferred;
+      std::uint32_t transmitClassEnqueued[WiFiNetwork::eTRANSMIT_CLASS_COUNT];
+      std::uint32_t transmitClassSent[WiFiNetwork::eTRANSMIT_CLASS_COUNT];
+      std::uint32_t transmitClassDropped[WiFiNetwork::eTRANSMIT_CLASS_COUNT];
+      std::uint32_t receiveBatches;
+      std::uint32_t receiveFrames;
+      std::uint32_t receiveBatchMax;
+      std::uint32_t receiveDropped;
+      std::uint32_t receivePostRetries;
+    } Statistics_t;
+
   public:
     explicit WiFiNetwork(EmwApiBase::EmwInterface wiFiInterface, struct netif &networkInterface) noexcept;
   public:
@@ -82,17 +114,27 @@ class WiFiNetwork final {
   public:
     ip_addr_t staticMaskAddress;
 
+  private:
+    static WiFiNetwork::TransmitClass ClassifyFrame(const struct pbuf &buffer) noexcept;
   private:
     static std::int32_t DeleteTransmitFifo(void) noexcept;
+  private:
+    static struct pbuf *DequeueOutput(WiFiNetwork::TransmitClass &transmitClass) noexcept;
   private:
     static void InformOfDriverStatus(EmwApiBase::EmwInterface interface,
                                      enum EmwApiBase::WiFiEvent status, void *argPtr) noexcept;
+  private:
+    static void InputBatchInTcpip(void *argumentPtr) noexcept;
   private:
     static void InputFromDriver(EmwNetworkStack::Buffer_t *bufferPtr, std::uint32_t interfaceIndex) noexcept;
   private:
     static void InputNetif(struct netif &networkInterface, EmwNetworkStack::Buffer_t *bufferPtr) noexcept;
   private:
     static void NetifStatusCallback(struct netif *netifPtr) noexcept;
+  private:
+    static void QueueInput(struct netif &networkInterface, struct pbuf *bufferPtr) noexcept;
+  private:
+    static err_t QueueOutput(struct pbuf *bufferPtr, WiFiNetwork::TransmitClass transmitClass) noexcept;
   private:
     static err_t OutputToDriver(struct netif *netifPtr, struct pbuf *bufferPtr) noexcept;
   private:
@@ -101,7 +143,11 @@ class WiFiNetwork final {
     static void TranmitThreadFunction(void *THIS) noexcept;
 
   public:
-    static void CheckIoSpeed(void) noexcept;
+    static class EmwApiCore &GetDriver(void) noexcept;
+  public:
+    static void GetOutputStatistics(EmwCoreIpc::PostStatistics_t &statistics) noexcept;
+  public:
+    static void GetStatistics(WiFiNetwork::Statistics_t &statistics) noexcept;
   public:
     static class WiFiNetwork *MySelf(struct netif *netifPtr) noexcept;
   public:
@@ -126,7 +172,34 @@ class WiFiNetwork final {
   private:
     static class EmwApiEmwBypass Driver;
   private:
-    static sys_mbox_t TransmitFifo;
+    typedef struct {
+      struct pbuf *bufferPtr;
+      struct netif *netifPtr;
+    } ReceivedFrame_t;
+  private:
+    static const std::uint32_t RECEIVE_BATCH_COUNT_MAX = 16U;
+  private:
+    static const std::uint32_t RECEIVE_POST_RETRY_DELAY_MS = 1U;
+  private:
+    static WiFiNetwork::ReceivedFrame_t ReceiveBatch[WiFiNetwork::RECEIVE_BATCH_COUNT_MAX];
+  private:
+    static std::uint32_t ReceiveBatchReadIndex;
+  private:
+    static std::uint32_t ReceiveBatchCount;
+  private:
+    static bool ReceiveBatchPending;
+  private:
+    static WiFiNetwork::Statistics_t Statistics;
+  private:
+    static sys_mbox_t TransmitFifos[WiFiNetwork::eTRANSMIT_CLASS_COUNT];
+  private:
+    static sys_sem_t TransmitSem;
+  private:
+    static std::uint32_t TransmitQueueLevel;
+  private:
+    static volatile bool TransmitQueueThrottled;
+  private:
+    static std::uint32_t TransmitPriorityRun;
   private:
     static volatile bool TransmitThreadQuitFlag;
   private:
@@ -135,6 +208,20 @@ class WiFiNetwork final {
     const int TRANSMIT_THREAD_PRIORITY = 17;
   private:
     const int TRANSMIT_THREAD_STACK_SIZE = 256;
+  private:
+    static const std::uint32_t TRANSMIT_PRIORITY_RUN_MAX = 8U;
+  private:
+    static const std::uint32_t TRANSMIT_QUEUE_SIZE = 16U;
+  private:
+    static const std::uint32_t TRANSMIT_QUEUE_HIGH_WATERMARK = 12U;
+  private:
+    static const std::uint32_t TRANSMIT_QUEUE_LOW_WATERMARK = 4U;
+  private:
+    static const std::uint16_t DHCP6_SERVER_PORT = 547U;
+  private:
+    static const std::uint16_t DHCP6_CLIENT_PORT = 546U;
+  private:
+    static const std::uint16_t DNS_SERVER_PORT = 53U;
 };
 
 extern "C" err_t InitializeWiFiNetif(struct netif *netifPtr);
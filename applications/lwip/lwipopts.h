@@ -103,6 +103,13 @@ extern "C" {
   */
 #define MEM_ALIGNMENT                   4
 
+/**
+  * MEMCPY: the copies of the payloads (pbuf_copy_partial(), pbuf_clone()...) use MemoryCopy() of core.
+  * SMEMCPY is left to memcpy(), the compiler inlines the small copies of a known size.
+  */
+#include "memcopy.h"
+#define MEMCPY(dst,src,len)             MemoryCopy(dst,src,len)
+
 /**
   * MEM_SIZE: the size of the heap memory. If the application will send
   * a lot of data that needs to be copied, this must be set high.
@@ -713,6 +720,18 @@ extern "C" {
 #define CHECKSUM_CHECK_ICMP             1
 #define CHECKSUM_CHECK_ICMP6            1
 
+/**
+  * LWIP_CHKSUM: Checksum routine of the port, see LwipChecksum.cpp.
+  */
+#include <stdint.h>
+uint16_t LwipChecksum(const void *dataPtr, int length);
+#define LWIP_CHKSUM                     LwipChecksum
+
+/**
+  * LWIP_CHKSUM_ALGORITHM: lwip_standard_chksum() is still built, the cpubench command checks LWIP_CHKSUM against it.
+  */
+#define LWIP_CHKSUM_ALGORITHM           2
+
 /*
    ---------------------------------------
    ---------- IPv6 options ---------------
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "Console.hpp"
+#include <cstdint>
+
+class EmwApiCore;
+
+class AppConsoleIoBench final : public Cmd {
+  public:
+    explicit AppConsoleIoBench(EmwApiCore &emw) noexcept;
+  public:
+    virtual ~AppConsoleIoBench(void) noexcept override;
+  public:
+    std::int32_t execute(std::int32_t argc, char *argvPtrs[]) noexcept override;
+  public:
+    const char *getComment(void) const noexcept override
+    {
+#if defined(COMPILATION_WITH_FREERTOS)
+      return "iobench [-mecho|-mpost] [-dDurationMs] [-sSize] [-w]"
+             " (IPC throughput and latency percentiles per transfer size, -w adds the wake up latency, CSV output)";
+#else
+      return "iobench [-dDurationMs] [-sSize] [-w]"
+             " (IPC throughput and latency percentiles per transfer size, -w adds the wake up latency, CSV output)";
+#endif /* COMPILATION_WITH_FREERTOS */
+    }
+  public:
+    const char *getName(void) const noexcept override
+    {
+      return "iobench";
+    }
+
+  private:
+    std::int32_t doRun(bool isEcho, bool isWakeLatency, std::uint16_t size, std::uint32_t durationInMs,
+                       std::uint8_t (&buffer)[], std::uint32_t (&latencies)[]) noexcept;
+
+  private:
+    EmwApiCore &emw;
+
+  private:
+    static const std::uint32_t DURATION_MS = 2000U;
+  private:
+    static const std::uint32_t LATENCY_COUNT_MAX = 512U;
+  private:
+    static const std::uint16_t SIZES[];
+  private:
+    static const std::uint32_t TIMEOUT_MS = 5000U;
+};
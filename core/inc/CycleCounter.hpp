@@ -0,0 +1,45 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "stm32u5xx_hal.h"
+#include <cstdint>
+
+/* DWT cycle counter of the core, shared by the console benches. */
+class CycleCounter final {
+  public:
+    static void Start(void) noexcept
+    {
+      /* Read, modify and write: a compound assignment on the volatile registers is deprecated in C++20. */
+      const std::uint32_t demcr = DCB->DEMCR;
+      DCB->DEMCR = demcr | DCB_DEMCR_TRCENA_Msk;
+      const std::uint32_t control = DWT->CTRL;
+      DWT->CTRL = control | DWT_CTRL_CYCCNTENA_Msk;
+    }
+  public:
+    static std::uint32_t Get(void) noexcept
+    {
+      return DWT->CYCCNT;
+    }
+  public:
+    static std::uint32_t ToMicroSeconds(std::uint32_t cycles) noexcept
+    {
+      return static_cast<std::uint32_t>((static_cast<std::uint64_t>(cycles) * 1000000U) / SystemCoreClock);
+    }
+};
@@ -74,7 +74,8 @@ extern "C" {
 /******************************************************************************/
 /* Memory allocation related definitions. *************************************/
 /******************************************************************************/
-#define configSUPPORT_STATIC_ALLOCATION            0
+#define configSUPPORT_STATIC_ALLOCATION            1
+#define configKERNEL_PROVIDED_STATIC_MEMORY        1
 #define configSUPPORT_DYNAMIC_ALLOCATION           1
 #define configTOTAL_HEAP_SIZE                      (130*1024)
 #define configENABLE_HEAP_PROTECTOR                1
@@ -127,6 +128,7 @@ extern "C" {
 /* Definitions that include or exclude functionality. *************************/
 /******************************************************************************/
 #define configUSE_TASK_NOTIFICATIONS               1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES      5
 #define configUSE_MUTEXES                          1
 #define configUSE_RECURSIVE_MUTEXES                1
 #define configUSE_COUNTING_SEMAPHORES              1
@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#ifndef MEMCOPY_H
+#define MEMCOPY_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#include "stm32u5xx_hal.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/* From this length MemoryCopyAsync() hands the copy to the GPDMA, 0 never uses the GPDMA. */
+#define MEMORY_COPY_DMA_THRESHOLD (512U)
+
+typedef void (*MemoryCopyDoneFunction_t)(void *contextPtr);
+
+extern DMA_HandleTypeDef hGpdma1Channel6;
+
+void InitializeMemoryCopy(void);
+void *MemoryCopy(void *destinationPtr, const void *sourcePtr, size_t length);
+bool MemoryCopyAsync(void *destinationPtr, const void *sourcePtr, size_t length,
+                     MemoryCopyDoneFunction_t doneFunction, void *contextPtr);
+bool MemoryCopyAsyncIsBusy(void);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* MEMCOPY_H */
@@ -28,6 +28,7 @@ void EXTI14_IRQHandler(void);
 void EXTI15_IRQHandler(void);
 void GPDMA1_Channel4_IRQHandler(void);
 void GPDMA1_Channel5_IRQHandler(void);
+void GPDMA1_Channel6_IRQHandler(void);
 void HardFault_Handler(void);
 void MemManage_Handler(void);
 void NMI_Handler(void);
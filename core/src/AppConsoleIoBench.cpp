@@ -0,0 +1,221 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "AppConsoleIoBench.hpp"
+#include "CycleCounter.hpp"
+#include "EmwApiCore.hpp"
+#include "EmwIoSpi.hpp"
+#include "EmwNetworkStack.hpp"
+#include "EmwOsInterface.hpp"
+#include "stm32u5xx_hal.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+//#define STD_PRINTF(...) (void) std::printf(__VA_ARGS__);
+#define STD_PRINTF(...)
+
+
+AppConsoleIoBench::AppConsoleIoBench(EmwApiCore &emw) noexcept
+  : emw(emw)
+{
+  STD_PRINTF("AppConsoleIoBench::AppConsoleIoBench()>\n")
+  STD_PRINTF("AppConsoleIoBench::AppConsoleIoBench(): %p\n", static_cast<const void*>(&emw))
+  STD_PRINTF("AppConsoleIoBench::AppConsoleIoBench()<\n")
+}
+
+AppConsoleIoBench::~AppConsoleIoBench(void) noexcept
+{
+  STD_PRINTF("AppConsoleIoBench::~AppConsoleIoBench()>\n")
+  STD_PRINTF("AppConsoleIoBench::~AppConsoleIoBench()< %p\n", static_cast<const void*>(&emw))
+}
+
+/* The sizes are the ones of the whole IPC packet, its header included.
+ * "echo" waits for each echo, so the latency is the round trip and both directions are counted in the throughput.
+ * "post" does not wait for the echoes, the latency is the time to hand the packet to the IO thread
+ * and only the sent bytes are counted. The echoes are checked at the end of the run, a transfer counts only once
+ * its echo came back. The post window needs an RTOS, so "post" is not in the NoOS build.
+ * "-w" adds the time from the notify line interrupt to the IO thread waking up for it.
+ */
+std::int32_t AppConsoleIoBench::execute(std::int32_t argc, char *argvPtrs[]) noexcept
+{
+  std::int32_t status = 0;
+  bool is_echo = true;
+  bool is_wake_latency = false;
+  std::uint32_t duration_in_ms = AppConsoleIoBench::DURATION_MS;
+  std::uint16_t size = 0U;
+
+  STD_PRINTF("\nAppConsoleIoBench::execute()>\n")
+
+  for (std::int32_t i = 1; i < argc; i++) {
+    if (nullptr != argvPtrs[i]) {
+      if (0 == std::strcmp("-mecho", argvPtrs[i])) {
+        is_echo = true;
+      }
+#if defined(COMPILATION_WITH_FREERTOS)
+      else if (0 == std::strcmp("-mpost", argvPtrs[i])) {
+        is_echo = false;
+      }
+#endif /* COMPILATION_WITH_FREERTOS */
+      else if (0 == std::strncmp("-d", argvPtrs[i], 2)) {
+        duration_in_ms = static_cast<std::uint32_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else if (0 == std::strncmp("-s", argvPtrs[i], 2)) {
+        size = static_cast<std::uint16_t>(std::atoi(argvPtrs[i] + 2));
+      }
+      else if (0 == std::strcmp("-w", argvPtrs[i])) {
+        is_wake_latency = true;
+      }
+      else {
+        (void) std::printf("%s: error with bad argument \"%s\"!\n", this->getName(), argvPtrs[i]);
+        return -1;
+      }
+    }
+  }
+  if ((0U != size) && ((16U > size) || (EmwNetworkStack::NETWORK_BUFFER_SIZE < size))) {
+    (void) std::printf("%s: size must be in [16..%" PRIu32 "]\n", this->getName(),
+                       static_cast<std::uint32_t>(EmwNetworkStack::NETWORK_BUFFER_SIZE));
+    return -1;
+  }
+  {
+    const std::size_t latencies_size = sizeof(std::uint32_t) * AppConsoleIoBench::LATENCY_COUNT_MAX;
+    std::unique_ptr<std::uint8_t, decltype(&EmwOsInterface::Free)> \
+    buffer_ptr(static_cast<std::uint8_t *>(EmwOsInterface::Malloc(EmwNetworkStack::NETWORK_BUFFER_SIZE)),
+               &EmwOsInterface::Free);
+    std::unique_ptr<std::uint32_t, decltype(&EmwOsInterface::Free)> \
+    latencies_ptr(static_cast<std::uint32_t *>(EmwOsInterface::Malloc(latencies_size)), &EmwOsInterface::Free);
+
+    if ((nullptr == buffer_ptr) || (nullptr == latencies_ptr)) {
+      (void) std::printf("%s: no memory\n", this->getName());
+      return -1;
+    }
+    CycleCounter::Start();
+    (void) std::printf("mode,size,transfers,errors,duration_ms,bytes,kbit_per_s,min_us,p50_us,p90_us,p99_us,max_us%s\n",
+                       is_wake_latency ? ",wakes,wake_min_us,wake_avg_us,wake_max_us" : "");
+    for (std::uint32_t i = 0U; (0 == status) && (0U != AppConsoleIoBench::SIZES[i]); i++) {
+      const std::uint16_t run_size = (0U != size) ? size : AppConsoleIoBench::SIZES[i];
+
+      status = this->doRun(is_echo, is_wake_latency, run_size, duration_in_ms,
+                           reinterpret_cast<std::uint8_t (&)[]>(*buffer_ptr.get()),
+                           reinterpret_cast<std::uint32_t (&)[]>(*latencies_ptr.get()));
+      if (0U != size) {
+        break;
+      }
+    }
+  }
+  STD_PRINTF("\nAppConsoleIoBench::execute()<\n\n")
+  return status;
+}
+
+/* Only the last LATENCY_COUNT_MAX latencies are kept for the percentiles. */
+std::int32_t AppConsoleIoBench::doRun(bool isEcho, bool isWakeLatency, std::uint16_t size, std::uint32_t durationInMs,
+                                      std::uint8_t (&buffer)[], std::uint32_t (&latencies)[]) noexcept
+{
+  std::uint32_t transfers = 0U;
+  std::uint32_t errors = 0U;
+  std::uint64_t bytes = 0U;
+  const std::uint32_t tstart = HAL_GetTick();
+  std::uint32_t duration_in_ms = 0U;
+  EmwIoSpi::WakeLatency_t wake_latency = {0U, 0U, 0U, 0U};
+
+  for (std::uint32_t i = 0U; i < size; i++) {
+    buffer[i] = static_cast<std::uint8_t>(i);
+  }
+  if (isWakeLatency) {
+    EmwIoSpi::StartWakeLatency();
+  }
+  while (duration_in_ms < durationInMs) {
+    const std::uint32_t cycles_start = CycleCounter::Get();
+    EmwApiBase::Status status;
+    std::uint16_t echoed_length = 0U;
+
+    if (isEcho) {
+      echoed_length = size;
+      status = this->emw.testIpcEcho(buffer, size, buffer, echoed_length, AppConsoleIoBench::TIMEOUT_MS);
+    }
+    else {
+      status = this->emw.testIpcPost(buffer, size, AppConsoleIoBench::TIMEOUT_MS);
+    }
+    if (EmwApiBase::eEMW_STATUS_OK == status) {
+      latencies[transfers % AppConsoleIoBench::LATENCY_COUNT_MAX] \
+        = CycleCounter::ToMicroSeconds(CycleCounter::Get() - cycles_start);
+      transfers++;
+      bytes += static_cast<std::uint64_t>(size) + echoed_length;
+    }
+    else {
+      errors++;
+      if (10U < errors) {
+        break;
+      }
+    }
+    duration_in_ms = HAL_GetTick() - tstart;
+  }
+  if (!isEcho) {
+    std::uint32_t echoed_length = 0U;
+
+    if (EmwApiBase::eEMW_STATUS_OK != this->emw.testIpcPostCheck(echoed_length, AppConsoleIoBench::TIMEOUT_MS)) {
+      const std::uint32_t echoed_count = echoed_length / size;
+      const std::uint32_t confirmed_count = (echoed_count < transfers) ? echoed_count : transfers;
+
+      errors += transfers - confirmed_count;
+      transfers = confirmed_count;
+      bytes = static_cast<std::uint64_t>(size) * transfers;
+    }
+  }
+  if (isWakeLatency) {
+    EmwIoSpi::StopWakeLatency(wake_latency);
+  }
+  {
+    const std::uint32_t count = (transfers < AppConsoleIoBench::LATENCY_COUNT_MAX) \
+                                ? transfers : AppConsoleIoBench::LATENCY_COUNT_MAX;
+    const std::uint32_t kbit_per_s = (0U != duration_in_ms) \
+                                     ? static_cast<std::uint32_t>((bytes * 8U) / duration_in_ms) : 0U;
+    std::uint32_t percentiles[5] = {0U, 0U, 0U, 0U, 0U};
+
+    if (0U != count) {
+      std::sort(&latencies[0], &latencies[count]);
+      percentiles[0] = latencies[0];
+      percentiles[1] = latencies[((count - 1U) * 50U) / 100U];
+      percentiles[2] = latencies[((count - 1U) * 90U) / 100U];
+      percentiles[3] = latencies[((count - 1U) * 99U) / 100U];
+      percentiles[4] = latencies[count - 1U];
+    }
+    (void) std::printf("%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32
+                       ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32,
+                       isEcho ? "echo" : "post", static_cast<std::uint32_t>(size), transfers, errors, duration_in_ms,
+                       static_cast<std::uint32_t>(bytes), kbit_per_s,
+                       percentiles[0], percentiles[1], percentiles[2], percentiles[3], percentiles[4]);
+    if (isWakeLatency) {
+      const std::uint32_t average_cycles = (0U != wake_latency.count) \
+                                           ? static_cast<std::uint32_t>(wake_latency.sumCycles / wake_latency.count)
+                                           : 0U;
+
+      (void) std::printf(",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32, wake_latency.count,
+                         CycleCounter::ToMicroSeconds(wake_latency.minCycles),
+                         CycleCounter::ToMicroSeconds(average_cycles),
+                         CycleCounter::ToMicroSeconds(wake_latency.maxCycles));
+    }
+    (void) std::printf("\n");
+  }
+  return (0U == transfers) ? -1 : 0;
+}
+
+const std::uint16_t AppConsoleIoBench::SIZES[] = {16U, 64U, 256U, 1024U, EmwNetworkStack::NETWORK_BUFFER_SIZE, 0U};
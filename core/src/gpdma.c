@@ -29,4 +29,6 @@ void InitializeGPDMA1(void)
   HAL_NVIC_EnableIRQ(GPDMA1_Channel4_IRQn);
   HAL_NVIC_SetPriority(GPDMA1_Channel5_IRQn, 2, 0);
   HAL_NVIC_EnableIRQ(GPDMA1_Channel5_IRQn);
+  HAL_NVIC_SetPriority(GPDMA1_Channel6_IRQn, 2, 0);
+  HAL_NVIC_EnableIRQ(GPDMA1_Channel6_IRQn);
 }
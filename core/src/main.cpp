@@ -22,6 +22,7 @@
 #include "gpdma.h"
 #include "gpio.h"
 #include "icache.h"
+#include "memcopy.h"
 #include "rng.h"
 #include "spi.h"
 #include "tim.h"
@@ -73,6 +74,7 @@ int main(void)
   InitializeUSART1();
   InitializeTIM2();
   InitializeGPDMA1();
+  InitializeMemoryCopy();
   InitializeICACHE();
   InitializeDCACHE1();
   InitializeSPI2();
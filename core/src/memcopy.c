@@ -0,0 +1,208 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "memcopy.h"
+#include "stm32u5xx_hal_dma.h"
+#include "main.hpp"
+#include <stdint.h>
+
+static void MemoryCopyDmaDone(DMA_HandleTypeDef *dmaPtr);
+static void SetDmaDataWidth(uint32_t dataWidth);
+
+DMA_HandleTypeDef hGpdma1Channel6;
+
+static volatile bool DmaIsBusy = false;
+static MemoryCopyDoneFunction_t DmaDoneFunction = NULL;
+static void *DmaDoneContextPtr = NULL;
+static uint32_t DmaDataWidth = 0U;
+
+/* Channel 6 of the GPDMA1 is kept for the memory to memory copies, without hardware request. */
+void InitializeMemoryCopy(void)
+{
+  hGpdma1Channel6.Instance = GPDMA1_Channel6;
+  hGpdma1Channel6.Init.Request = DMA_REQUEST_SW;
+  hGpdma1Channel6.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+  hGpdma1Channel6.Init.Direction = DMA_MEMORY_TO_MEMORY;
+  hGpdma1Channel6.Init.SrcInc = DMA_SINC_INCREMENTED;
+  hGpdma1Channel6.Init.DestInc = DMA_DINC_INCREMENTED;
+  hGpdma1Channel6.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_BYTE;
+  hGpdma1Channel6.Init.DestDataWidth = DMA_DEST_DATAWIDTH_BYTE;
+  hGpdma1Channel6.Init.Priority = DMA_LOW_PRIORITY_LOW_WEIGHT;
+  hGpdma1Channel6.Init.SrcBurstLength = 1;
+  hGpdma1Channel6.Init.DestBurstLength = 1;
+  hGpdma1Channel6.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+  hGpdma1Channel6.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+  hGpdma1Channel6.Init.Mode = DMA_NORMAL;
+  SetDmaDataWidth(DMA_SRC_DATAWIDTH_WORD);
+  if (HAL_DMA_ConfigChannelAttributes(&hGpdma1Channel6, DMA_CHANNEL_NPRIV) != HAL_OK) {
+    ErrorHandler();
+  }
+  hGpdma1Channel6.XferCpltCallback = MemoryCopyDmaDone;
+  hGpdma1Channel6.XferErrorCallback = MemoryCopyDmaDone;
+}
+
+/* Copies by 32 bytes once the destination is aligned, the source is read with unaligned word accesses
+ * when it cannot be aligned as well (supported by the Cortex-M33 on the SRAM).
+ * The compiler must not turn the loops back into a call to memcpy().
+ */
+__attribute__((optimize("no-tree-loop-distribute-patterns")))
+void *MemoryCopy(void *destinationPtr, const void *sourcePtr, size_t length)
+{
+  uint8_t *destination_ptr = (uint8_t *) destinationPtr;
+  const uint8_t *source_ptr = (const uint8_t *) sourcePtr;
+
+  if (length >= 16U) {
+    while (((uintptr_t) destination_ptr & 3U) != 0U) {
+      *destination_ptr++ = *source_ptr++;
+      length--;
+    }
+    if (((uintptr_t) source_ptr & 3U) == 0U) {
+      uint32_t *destination_word_ptr = (uint32_t *) destination_ptr;
+      const uint32_t *source_word_ptr = (const uint32_t *) source_ptr;
+
+      while (length >= 32U) {
+        const uint32_t word0 = source_word_ptr[0];
+        const uint32_t word1 = source_word_ptr[1];
+        const uint32_t word2 = source_word_ptr[2];
+        const uint32_t word3 = source_word_ptr[3];
+        const uint32_t word4 = source_word_ptr[4];
+        const uint32_t word5 = source_word_ptr[5];
+        const uint32_t word6 = source_word_ptr[6];
+        const uint32_t word7 = source_word_ptr[7];
+
+        destination_word_ptr[0] = word0;
+        destination_word_ptr[1] = word1;
+        destination_word_ptr[2] = word2;
+        destination_word_ptr[3] = word3;
+        destination_word_ptr[4] = word4;
+        destination_word_ptr[5] = word5;
+        destination_word_ptr[6] = word6;
+        destination_word_ptr[7] = word7;
+        destination_word_ptr += 8;
+        source_word_ptr += 8;
+        length -= 32U;
+      }
+      while (length >= 4U) {
+        *destination_word_ptr++ = *source_word_ptr++;
+        length -= 4U;
+      }
+      destination_ptr = (uint8_t *) destination_word_ptr;
+      source_ptr = (const uint8_t *) source_word_ptr;
+    }
+    else {
+      uint32_t *destination_word_ptr = (uint32_t *) destination_ptr;
+
+      while (length >= 16U) {
+        const uint32_t word0 = __UNALIGNED_UINT32_READ(&source_ptr[0]);
+        const uint32_t word1 = __UNALIGNED_UINT32_READ(&source_ptr[4]);
+        const uint32_t word2 = __UNALIGNED_UINT32_READ(&source_ptr[8]);
+        const uint32_t word3 = __UNALIGNED_UINT32_READ(&source_ptr[12]);
+
+        destination_word_ptr[0] = word0;
+        destination_word_ptr[1] = word1;
+        destination_word_ptr[2] = word2;
+        destination_word_ptr[3] = word3;
+        destination_word_ptr += 4;
+        source_ptr += 16;
+        length -= 16U;
+      }
+      while (length >= 4U) {
+        *destination_word_ptr++ = __UNALIGNED_UINT32_READ(source_ptr);
+        source_ptr += 4;
+        length -= 4U;
+      }
+      destination_ptr = (uint8_t *) destination_word_ptr;
+    }
+  }
+  while (length > 0U) {
+    *destination_ptr++ = *source_ptr++;
+    length--;
+  }
+  return destinationPtr;
+}
+
+/* Returns true when the copy is in progress on the GPDMA, the done function is then called from its interrupt.
+ * Below the threshold, beyond a block of the GPDMA or when the channel is busy, the copy is done at once
+ * by MemoryCopy() and the done function is called before returning false.
+ * The GPDMA copies words when both addresses and the length allow it, and bytes otherwise.
+ */
+bool MemoryCopyAsync(void *destinationPtr, const void *sourcePtr, size_t length,
+                     MemoryCopyDoneFunction_t doneFunction, void *contextPtr)
+{
+  bool is_started = false;
+
+  if ((MEMORY_COPY_DMA_THRESHOLD != 0U) && (length >= MEMORY_COPY_DMA_THRESHOLD) && (length <= 0xFFFFU)) {
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (!DmaIsBusy) {
+      DmaIsBusy = true;
+      is_started = true;
+    }
+    __set_PRIMASK(primask);
+  }
+  if (is_started) {
+    const uintptr_t alignment = (uintptr_t) destinationPtr | (uintptr_t) sourcePtr | (uintptr_t) length;
+
+    SetDmaDataWidth(((alignment & 3U) == 0U) ? DMA_SRC_DATAWIDTH_WORD : DMA_SRC_DATAWIDTH_BYTE);
+    DmaDoneFunction = doneFunction;
+    DmaDoneContextPtr = contextPtr;
+    if (HAL_DMA_Start_IT(&hGpdma1Channel6, (uint32_t) sourcePtr, (uint32_t) destinationPtr, (uint32_t) length)
+        != HAL_OK) {
+      DmaIsBusy = false;
+      is_started = false;
+    }
+  }
+  if (!is_started) {
+    (void) MemoryCopy(destinationPtr, sourcePtr, length);
+    if (doneFunction != NULL) {
+      doneFunction(contextPtr);
+    }
+  }
+  return is_started;
+}
+
+bool MemoryCopyAsyncIsBusy(void)
+{
+  return DmaIsBusy;
+}
+
+static void MemoryCopyDmaDone(DMA_HandleTypeDef *dmaPtr)
+{
+  const MemoryCopyDoneFunction_t done_function = DmaDoneFunction;
+
+  (void) dmaPtr;
+  DmaIsBusy = false;
+  if (done_function != NULL) {
+    done_function(DmaDoneContextPtr);
+  }
+}
+
+/* The channel is initialized again only when the data width changes. */
+static void SetDmaDataWidth(uint32_t dataWidth)
+{
+  if (DmaDataWidth != dataWidth) {
+    DmaDataWidth = dataWidth;
+    hGpdma1Channel6.Init.SrcDataWidth = dataWidth;
+    hGpdma1Channel6.Init.DestDataWidth = (dataWidth == DMA_SRC_DATAWIDTH_WORD) \
+                                         ? DMA_DEST_DATAWIDTH_WORD : DMA_DEST_DATAWIDTH_BYTE;
+    if (HAL_DMA_Init(&hGpdma1Channel6) != HAL_OK) {
+      ErrorHandler();
+    }
+  }
+}
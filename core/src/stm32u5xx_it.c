@@ -27,6 +27,7 @@ extern "C" {
 #include "gpdma.h"
 #include "gpio.h"
 #include "icache.h"
+#include "memcopy.h"
 #include "spi.h"
 #include "tim.h"
 #include "usart.h"
@@ -140,6 +141,11 @@ void GPDMA1_Channel5_IRQHandler(void)
   HAL_DMA_IRQHandler(&hGpdma1Channel5);
 }
 
+void GPDMA1_Channel6_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hGpdma1Channel6);
+}
+
 void TIM2_IRQHandler(void)
 {
   HAL_TIM_IRQHandler(&hTim2);
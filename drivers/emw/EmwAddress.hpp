@@ -85,6 +85,11 @@ typedef struct {
 #define EMW_FD_ISSET(n, p) ((p)->fds_bits[(n)/EMW_NFDBITS] & EMW_FDSET_MASK(n))
 #define EMW_FD_ZERO(P) std::memset((P), 0, sizeof(*(P)))
 
+typedef struct {
+  std::int32_t seconds;
+  std::int32_t microSeconds;
+} EmwTimeVal_t;
+
 #define EMW_IP6_ADDR_INVALID     0x00
 #define EMW_IP6_ADDR_TENTATIVE   0x08
 #define EMW_IP6_ADDR_TENTATIVE_1 0x09
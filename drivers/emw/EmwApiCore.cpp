@@ -62,6 +62,8 @@ EmwApiCore::EmwApiCore() noexcept
   , softAccessPointSettings()
   , lastScanResults()
   , callbacks()
+  , credentialCache()
+  , dnsCache()
 {
   DEBUG_API_LOG("\n EmwApiCore::EmwApiCore()>\n")
   DEBUG_API_LOG("\n EmwApiCore::EmwApiCore()< %p\n\n", static_cast<const void*>(this))
@@ -329,6 +331,8 @@ EmwApiBase::Status EmwApiCore::disconnect(void) noexcept
   if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
       BYTES_ARRAY_REF(&response_buffer), response_buffer_size, 15000U)) {
     if (0 == response_buffer.status) {
+      /* The resolutions may depend on the network left. */
+      this->dnsCache.flush();
       status = EmwApiBase::eEMW_STATUS_OK;
     }
   }
@@ -337,6 +341,11 @@ EmwApiBase::Status EmwApiCore::disconnect(void) noexcept
   return status;
 }
 
+void EmwApiCore::flushCredentialCache(void) noexcept
+{
+  this->credentialCache.invalidate();
+}
+
 const char *EmwApiCore::getConfigurationString(void) const noexcept
 {
   static const char configuration_string[] \
@@ -344,6 +353,11 @@ const char *EmwApiCore::getConfigurationString(void) const noexcept
   return configuration_string;
 }
 
+void EmwApiCore::getCredentialCacheStatistics(EmwCredentialCache::Statistics_t &statistics) const noexcept
+{
+  this->credentialCache.getStatistics(statistics);
+}
+
 void EmwApiCore::getStatistics(void) const noexcept
 {
   EMW_STATS_LOG()
@@ -511,13 +525,23 @@ EmwApiBase::Status EmwApiCore::initialize(void) noexcept
 
     if (0U == this->runtime.interfaces) {
       this->EmwCoreIpc::initialize();
+      /* The module comes out of a reset, nothing is uploaded yet. */
+      this->credentialCache.invalidate();
 #if defined(EMW_WITH_RTOS)
       {
         static const char receive_thread_name[] = {"EMW-ReceiveThread"};
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+        const EmwOsInterface::Status os_status = EmwOsInterface::CreateThread(EmwApiCore::ReceiveThread,
+          receive_thread_name,
+          EmwApiCore::ReceiveThreadFunction, static_cast<EmwOsInterface::ThreadFunctionArgument_t>(this),
+          EMW_RECEIVED_THREAD_STACK_SIZE, EMW_RECEIVED_THREAD_PRIORITY,
+          EmwApiCore::ReceiveThreadStorage, EmwApiCore::ReceiveThreadStack);
+#else
         const EmwOsInterface::Status os_status = EmwOsInterface::CreateThread(EmwApiCore::ReceiveThread,
           receive_thread_name,
           EmwApiCore::ReceiveThreadFunction, static_cast<EmwOsInterface::ThreadFunctionArgument_t>(this),
           EMW_RECEIVED_THREAD_STACK_SIZE, EMW_RECEIVED_THREAD_PRIORITY);
+#endif /* EMW_OS_WITH_STATIC_ALLOCATION */
         EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
       }
       EmwOsInterface::DelayTicks(1U);
@@ -646,6 +670,8 @@ EmwApiBase::Status EmwApiCore::resetModule(void) noexcept
 
   if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
       BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+    this->credentialCache.invalidate();
+    this->dnsCache.flush();
     status = EmwApiBase::eEMW_STATUS_OK;
   }
   DEBUG_API_LOG(" EmwApiCore::resetModule()< %" PRIi32 "\n\n", static_cast<std::int32_t>(status))
@@ -661,6 +687,8 @@ EmwApiBase::Status EmwApiCore::resetToFactoryDefault(void) noexcept
 
   if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
       BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+    this->credentialCache.invalidate();
+    this->dnsCache.flush();
     status = EmwApiBase::eEMW_STATUS_OK;
   }
   DEBUG_API_LOG(" EmwApiCore::resetToFactoryDefault()< %" PRIi32 "\n\n", static_cast<std::int32_t>(status))
@@ -799,24 +827,44 @@ EmwApiBase::Status EmwApiCore::setEapCert(std::uint8_t certificateType, const ch
 
   if (nullptr != certificateStringPtr) {
     const std::size_t certificate_length = std::strlen(certificateStringPtr);
-    const std::uint16_t command_data_size \
-      = static_cast<std::uint16_t>(sizeof(EmwCoreIpc::IpcWiFiEapSetCertParams_t) + certificate_length); /* len + 1 */
-    std::unique_ptr<EmwCoreIpc::IpcWiFiEapSetCertParams_t, decltype(&EmwOsInterface::Free)> \
-    command_data_ptr(static_cast<EmwCoreIpc::IpcWiFiEapSetCertParams_t *> \
-                     (EmwOsInterface::Malloc(command_data_size)), &EmwOsInterface::Free);
-    const EmwCoreIpc::CmdParams_s ipc_params(EmwCoreIpc::eWIFI_EAP_SET_CERT_CMD);
-    EmwCoreIpc::SysCommonResponseParams_t response_buffer;
-    uint16_t response_buffer_size = sizeof(response_buffer);
+    const EmwCredentialCache::Slot slot = (EmwCoreIpc::EAP_ROOTCA == certificateType) \
+                                          ? EmwCredentialCache::eEAP_ROOT_CA \
+                                          : ((EmwCoreIpc::EAP_CLIENT_CERT == certificateType) \
+                                             ? EmwCredentialCache::eEAP_CLIENT_CERTIFICATE \
+                                             : ((EmwCoreIpc::EAP_CLIENT_KEY == certificateType) \
+                                                ? EmwCredentialCache::eEAP_CLIENT_KEY \
+                                                : EmwCredentialCache::eSLOT_COUNT));
+
+    /* Unchanged since the last upload, the module still has it. */
+    if (this->credentialCache.isUploaded(slot, reinterpret_cast<const std::uint8_t *>(certificateStringPtr),
+                                         certificate_length)) {
+      status = EmwApiBase::eEMW_STATUS_OK;
+    }
+    else {
+      const std::uint32_t tick_start = HAL_GetTick();
+      const std::uint16_t command_data_size \
+        = static_cast<std::uint16_t>(sizeof(EmwCoreIpc::IpcWiFiEapSetCertParams_t) + certificate_length); /* len + 1 */
+      std::unique_ptr<EmwCoreIpc::IpcWiFiEapSetCertParams_t, decltype(&EmwOsInterface::Free)> \
+      command_data_ptr(static_cast<EmwCoreIpc::IpcWiFiEapSetCertParams_t *> \
+                       (EmwOsInterface::Malloc(command_data_size)), &EmwOsInterface::Free);
+      const EmwCoreIpc::CmdParams_s ipc_params(EmwCoreIpc::eWIFI_EAP_SET_CERT_CMD);
+      EmwCoreIpc::SysCommonResponseParams_t response_buffer;
+      uint16_t response_buffer_size = sizeof(response_buffer);
 
-    command_data_ptr->ipcParams = ipc_params;
-    command_data_ptr->eapSetCertParams.type = certificateType;
-    command_data_ptr->eapSetCertParams.length = static_cast<std::uint16_t>(certificate_length);
-    (void) std::memcpy(command_data_ptr->eapSetCertParams.cert, certificateStringPtr, certificate_length);
+      command_data_ptr->ipcParams = ipc_params;
+      command_data_ptr->eapSetCertParams.type = certificateType;
+      command_data_ptr->eapSetCertParams.length = static_cast<std::uint16_t>(certificate_length);
+      (void) std::memcpy(command_data_ptr->eapSetCertParams.cert, certificateStringPtr, certificate_length);
 
-    if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(command_data_ptr.get()), command_data_size,
-        BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
-      if (0 == response_buffer.status) {
-        status = EmwApiBase::eEMW_STATUS_OK;
+      /* The content of the slot in the module is unknown until the upload succeeds. */
+      this->credentialCache.invalidate(slot);
+      if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(command_data_ptr.get()), command_data_size,
+          BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+        if (0 == response_buffer.status) {
+          this->credentialCache.setUploaded(slot, reinterpret_cast<const std::uint8_t *>(certificateStringPtr),
+                                            certificate_length, HAL_GetTick() - tick_start);
+          status = EmwApiBase::eEMW_STATUS_OK;
+        }
       }
     }
   }
@@ -857,6 +905,27 @@ EmwApiBase::Status EmwApiCore::testIpcEcho(std::uint8_t (&dataIn)[], std::uint16
   return status;
 }
 
+EmwApiBase::Status EmwApiCore::testIpcPost(std::uint8_t (&dataIn)[], std::uint16_t dataInLength,
+    std::uint32_t timeoutInMs) noexcept
+{
+  EmwApiBase::Status status = EmwApiBase::eEMW_STATUS_ERROR;
+
+  if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::testIpcPost(dataIn, dataInLength, timeoutInMs)) {
+    status = EmwApiBase::eEMW_STATUS_OK;
+  }
+  return status;
+}
+
+EmwApiBase::Status EmwApiCore::testIpcPostCheck(std::uint32_t &echoedLength, std::uint32_t timeoutInMs) noexcept
+{
+  EmwApiBase::Status status = EmwApiBase::eEMW_STATUS_ERROR;
+
+  if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::testIpcPostCheck(echoedLength, timeoutInMs)) {
+    status = EmwApiBase::eEMW_STATUS_OK;
+  }
+  return status;
+}
+
 void EmwApiCore::unInitialize(void) noexcept
 {
   EmwScopedLock lock(DeviceAvailableLock);
@@ -886,6 +955,10 @@ void EmwApiCore::unInitialize(void) noexcept
 #if defined(EMW_WITH_RTOS)
 volatile bool EmwApiCore::ReceiveThreadQuitFlag;
 EmwOsInterface::Thread_t EmwApiCore::ReceiveThread;
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+EmwOsInterface::ThreadStorage_t EmwApiCore::ReceiveThreadStorage;
+EmwOsInterface::ThreadStack_t EmwApiCore::ReceiveThreadStack[EMW_RECEIVED_THREAD_STACK_SIZE];
+#endif /* EMW_OS_WITH_STATIC_ALLOCATION */
 
 void EmwApiCore::ReceiveThreadFunction(EmwOsInterface::ThreadFunctionArgument_t argument) noexcept
 {
@@ -943,11 +1016,12 @@ void EmwApiCore::processEvent(EmwNetworkStack::Buffer_t *networkBufferPtr, std::
 
 void EmwApiCore::ProcessRebootEvent(const EmwApiCore *THIS, EmwNetworkStack::Buffer_t *networkBufferPtr) noexcept
 {
-  static_cast<void>(THIS);
-
   if (nullptr != networkBufferPtr) {
     EmwNetworkStack::FreeBuffer(networkBufferPtr);
   }
+  /* The module has lost all the credentials uploaded so far, and its resolver state. */
+  const_cast<EmwApiCore *>(THIS)->credentialCache.invalidate();
+  const_cast<EmwApiCore *>(THIS)->dnsCache.flush();
   DEBUG_API_LOG("\n     EmwApiCore::ProcessRebootEvent(): EVENT: reboot done.\n")
 }
 
@@ -991,6 +1065,10 @@ void EmwApiCore::ProcessWiFiStatusEvent(const EmwApiCore *THIS, EmwNetworkStack:
   if (nullptr != networkBufferPtr) {
     EmwNetworkStack::FreeBuffer(networkBufferPtr);
   }
+  if (EmwApiBase::eWIFI_EVENT_STA_DOWN == event) {
+    /* The resolutions may depend on the network left. */
+    const_cast<EmwApiCore *>(THIS)->dnsCache.flush();
+  }
   switch (event) {
     case EmwApiBase::eWIFI_EVENT_STA_UP:
     case EmwApiBase::eWIFI_EVENT_STA_DOWN:
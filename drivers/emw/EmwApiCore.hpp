@@ -20,6 +20,8 @@
 
 #include "EmwApiBase.hpp"
 #include "EmwCoreIpc.hpp"
+#include "EmwCredentialCache.hpp"
+#include "EmwDnsCache.hpp"
 #include "EmwOsInterface.hpp"
 #include <cstdint>
 
@@ -53,8 +55,12 @@ class EmwApiCore : protected /*private*/ EmwCoreIpc {
     EmwApiBase::Status connectWPS(void) noexcept;
   public:
     EmwApiBase::Status disconnect(void) noexcept;
+  public:
+    void flushCredentialCache(void) noexcept;
   public:
     const char *getConfigurationString(void) const noexcept;
+  public:
+    void getCredentialCacheStatistics(EmwCredentialCache::Statistics_t &statistics) const noexcept;
   public:
     void getStatistics(void) const noexcept;
   public:
@@ -106,6 +112,11 @@ class EmwApiCore : protected /*private*/ EmwCoreIpc {
   public:
     EmwApiBase::Status testIpcEcho(std::uint8_t (&dataIn)[], std::uint16_t dataInLength,
                                    std::uint8_t (&dataOut)[], std::uint16_t &dataOutLength, std::uint32_t timeoutInMs) noexcept;
+  public:
+    EmwApiBase::Status testIpcPost(std::uint8_t (&dataIn)[], std::uint16_t dataInLength,
+                                   std::uint32_t timeoutInMs) noexcept;
+  public:
+    EmwApiBase::Status testIpcPostCheck(std::uint32_t &echoedLength, std::uint32_t timeoutInMs) noexcept;
   public:
     void unInitialize(void) noexcept;
   public:
@@ -180,6 +191,11 @@ class EmwApiCore : protected /*private*/ EmwCoreIpc {
       EmwApiBase::NetlinkInputCallback_t netlinkInputCallback;
     } callbacks;
 
+  protected:
+    EmwCredentialCache credentialCache;
+  protected:
+    EmwDnsCache dnsCache;
+
   private:
     void processEvent(EmwNetworkStack::Buffer_t *networkBufferPtr, std::uint16_t apiId) noexcept override;
   private:
@@ -196,6 +212,12 @@ class EmwApiCore : protected /*private*/ EmwCoreIpc {
 #if defined(EMW_WITH_RTOS)
   private:
     static EmwOsInterface::Thread_t ReceiveThread;
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+  private:
+    static EmwOsInterface::ThreadStorage_t ReceiveThreadStorage;
+  private:
+    static EmwOsInterface::ThreadStack_t ReceiveThreadStack[EMW_RECEIVED_THREAD_STACK_SIZE];
+#endif /* EMW_OS_WITH_STATIC_ALLOCATION */
   private:
     static volatile bool ReceiveThreadQuitFlag;
   private:
@@ -41,6 +41,7 @@ template<typename T> void copyStringToArray(T destination[], std::size_t destina
 
 EmwApiEmw::EmwApiEmw(void) noexcept
   : EmwApiCore()
+  , socketWatcher(*this)
 {
   DEBUG_API_LOG("\n EmwApiEmw::EmwApiEmw()>\n")
   DEBUG_API_LOG("\n EmwApiEmw::EmwApiEmw()< %p\n\n", static_cast<const void*>(this))
@@ -52,6 +53,70 @@ EmwApiEmw::~EmwApiEmw(void)
   DEBUG_API_LOG("\n EmwApiEmw::~EmwApiEmw()<\n\n")
 }
 
+void EmwApiEmw::flushDnsCache(void) noexcept
+{
+  this->dnsCache.flush();
+}
+
+void EmwApiEmw::getDnsCacheStatistics(EmwDnsCache::Statistics_t &statistics) const noexcept
+{
+  this->dnsCache.getStatistics(statistics);
+}
+
+std::int32_t EmwApiEmw::socketAccept(std::int32_t socketFd,
+                                     EmwAddress::SockAddr_t &socketAddress, std::uint32_t &socketAddressLength) noexcept
+{
+  std::int32_t ret_fd = -4;
+
+  DEBUG_API_LOG("\n EmwApiEmw::socketAccept()>\n")
+
+  if (0 <= socketFd) {
+    EmwCoreIpc::IpcSocketAcceptParams_t command_data(socketFd);
+    EmwCoreIpc::SocketAcceptResponseParams_t response_buffer;
+    std::uint16_t response_buffer_size = sizeof(response_buffer);
+
+    ret_fd = -1;
+    if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
+        BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+      ret_fd = response_buffer.socket;
+      if (0 <= ret_fd) {
+        (void) socketAddress_FromPacked(response_buffer.addr, socketAddress, socketAddressLength);
+      }
+    }
+  }
+  DEBUG_API_LOG(" EmwApiEmw::socketAccept()< %" PRIi32 "\n\n", ret_fd)
+  return ret_fd;
+}
+
+std::int32_t EmwApiEmw::socketBind(std::int32_t socketFd,
+                                   const EmwAddress::SockAddr_t &socketAddress, std::int32_t socketAddressLength) noexcept
+{
+  std::int32_t status = -4;
+
+  DEBUG_API_LOG("\n EmwApiEmw::socketBind()>\n")
+
+  if ((0 <= socketFd) && (0 < socketAddressLength)) {
+    EmwCoreIpc::IpcSocketBindParams_t command_data;
+
+    status = -1;
+    if (socketAddress_ToPacked(socketAddress, socketAddressLength, command_data.bindParams.addr)) {
+      EmwCoreIpc::SocketBindResponseParams_t response_buffer;
+      std::uint16_t response_buffer_size = sizeof(response_buffer);
+
+      command_data.bindParams.socket = socketFd;
+      command_data.bindParams.length = static_cast<EmwAddress::SockLen_t>(socketAddressLength);
+      if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
+          BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+        if (0 == response_buffer.status) {
+          status = 0;
+        }
+      }
+    }
+  }
+  DEBUG_API_LOG(" EmwApiEmw::socketBind()< %" PRIi32 "\n\n", status)
+  return status;
+}
+
 std::int32_t EmwApiEmw::socketClose(std::int32_t socketFd) noexcept
 {
   std::int32_t status = -4;
@@ -136,49 +201,69 @@ std::int32_t EmwApiEmw::socketConnect(std::int32_t socketFd,
 }
 
 std::int32_t EmwApiEmw::socketGetAddrInfo(const char (&nodeNameString)[255], const char (&serviceNameString)[255],
-    const EmwAddress::AddrInfo_t &hints, EmwAddress::AddrInfo_t &result) noexcept
+    const EmwAddress::AddrInfo_t &hints, EmwAddress::AddrInfo_t &result, bool useDnsCache) noexcept
 {
   std::int32_t ret = -1;
-  EmwCoreIpc::IpcSocketGetAddrInfoParam_t command_data;
-  EmwCoreIpc::SocketGetAddrInfoResponseParam_t response_buffer;
-  std::uint16_t response_buffer_size = sizeof(response_buffer);
+  EmwDnsCache::Answer_t cache_hints;
+  EmwDnsCache::Answer_t cache_answer;
+  bool is_negative = false;
+  /* The port of a service is not part of the cache key. */
+  const bool is_cacheable = ('\0' == serviceNameString[0]);
 
   DEBUG_API_LOG("\n EmwApiEmw::socketGetAddrInfo()>\n")
 
-  STRING_COPY_TO_ARRAY_CHAR(command_data.getAddrInfoParams.nodeName, nodeNameString);
-  STRING_COPY_TO_ARRAY_CHAR(command_data.getAddrInfoParams.serviceName, serviceNameString);
-  command_data.getAddrInfoParams.hints = hints;
-
-  if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
-      BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
-    if (0 == response_buffer.status) {
-      result.flags = response_buffer.res.flags;
-      result.family = response_buffer.res.family;
-      result.sockType = response_buffer.res.sockType;
-      result.protocol = response_buffer.res.protocol;
-      result.addrLen = response_buffer.res.addrLen;
-      result.sAddr.length = response_buffer.res.sAddr.length;
-      result.sAddr.family = response_buffer.res.sAddr.family;
-      /* Keep port possibly set as it is. */
-      result.sAddr.data2[0] = response_buffer.res.sAddr.data2[0];
-      result.sAddr.data2[1] = response_buffer.res.sAddr.data2[1];
-      result.sAddr.data2[2] = response_buffer.res.sAddr.data2[2];
-      result.sAddr.data3[0] = response_buffer.res.sAddr.data3[0];
-      result.sAddr.data3[1] = response_buffer.res.sAddr.data3[1];
-      result.sAddr.data3[2] = response_buffer.res.sAddr.data3[2];
-      (void) std::memcpy(result.canonName, response_buffer.res.canonName, sizeof(result.canonName));
-      result.canonName[sizeof(result.canonName) - 1] = '\0';
+  cache_hints.family = hints.family;
+  cache_hints.sockType = hints.sockType;
+  cache_hints.protocol = hints.protocol;
+  if (is_cacheable && useDnsCache
+      && this->dnsCache.lookUp(nodeNameString, EmwDnsCache::eADDR_INFO, cache_hints, cache_answer, is_negative)) {
+    if (!is_negative) {
+      EmwApiEmw::socketAddrInfo_FromCache(cache_answer, result);
       ret = 0;
     }
-    else {
-      DEBUG_API_LOG(" EmwApiEmw::socketGetAddrInfo(): %" PRIi32 "\n\n", static_cast<std::int32_t>(response_buffer.status))
+  }
+  else {
+    EmwCoreIpc::IpcSocketGetAddrInfoParam_t command_data;
+    EmwCoreIpc::SocketGetAddrInfoResponseParam_t response_buffer;
+    std::uint16_t response_buffer_size = sizeof(response_buffer);
+
+    STRING_COPY_TO_ARRAY_CHAR(command_data.getAddrInfoParams.nodeName, nodeNameString);
+    STRING_COPY_TO_ARRAY_CHAR(command_data.getAddrInfoParams.serviceName, serviceNameString);
+    command_data.getAddrInfoParams.hints = hints;
+
+    if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
+        BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+      if (0 == response_buffer.status) {
+        cache_answer.flags = response_buffer.res.flags;
+        cache_answer.family = response_buffer.res.family;
+        cache_answer.sockType = response_buffer.res.sockType;
+        cache_answer.protocol = response_buffer.res.protocol;
+        cache_answer.addrLen = response_buffer.res.addrLen;
+        cache_answer.sAddr = response_buffer.res.sAddr;
+        EmwApiEmw::socketAddrInfo_FromCache(cache_answer, result);
+        (void) std::memcpy(result.canonName, response_buffer.res.canonName, sizeof(result.canonName));
+        result.canonName[sizeof(result.canonName) - 1] = '\0';
+        /* The answers with a canonical name too long for an entry are never cached. */
+        if (is_cacheable && (std::strlen(result.canonName) < sizeof(cache_answer.canonName))) {
+          (void) std::strncpy(cache_answer.canonName, result.canonName, sizeof(cache_answer.canonName) - 1U);
+          this->dnsCache.store(nodeNameString, EmwDnsCache::eADDR_INFO, cache_hints, &cache_answer);
+        }
+        ret = 0;
+      }
+      else {
+        DEBUG_API_LOG(" EmwApiEmw::socketGetAddrInfo(): %" PRIi32 "\n\n", static_cast<std::int32_t>(response_buffer.status))
+        /* Only an answer of the module is cached as a failure, not a lost request. */
+        if (is_cacheable) {
+          this->dnsCache.store(nodeNameString, EmwDnsCache::eADDR_INFO, cache_hints, nullptr);
+        }
+      }
     }
   }
   return ret;
 }
 
 std::int32_t EmwApiEmw::socketGetHostByName(EmwAddress::SockAddr_t &socketAddress,
-    const char (&nameString)[255]) noexcept
+    const char (&nameString)[255], bool useDnsCache) noexcept
 {
   std::int32_t status = -4;
   EmwCoreIpc::IpcSocketGetHostByNameParams_t command_data;
@@ -186,27 +271,101 @@ std::int32_t EmwApiEmw::socketGetHostByName(EmwAddress::SockAddr_t &socketAddres
   DEBUG_API_LOG("\n EmwApiEmw::socketGetHostByName()>\n")
 
   if (std::strlen(nameString) < sizeof(command_data.getHostByNameParams.name)) {
-    EmwCoreIpc::SocketGetHostByNameResponseParams_t response_buffer;
-    std::uint16_t response_buffer_size = sizeof(response_buffer);
+    const EmwDnsCache::Answer_t cache_hints;
+    EmwDnsCache::Answer_t cache_answer;
+    bool is_negative = false;
 
     status = -1;
-    STRING_COPY_TO_ARRAY_CHAR(command_data.getHostByNameParams.name, nameString);
-    if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
-        BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
-      if (0 == response_buffer.status) {
-        /* Only for IPv4 address. */
+    if (useDnsCache
+        && this->dnsCache.lookUp(nameString, EmwDnsCache::eHOST_BY_NAME, cache_hints, cache_answer, is_negative)) {
+      if (!is_negative) {
         EmwAddress::SockAddrIn_t &socket_address_in = reinterpret_cast<EmwAddress::SockAddrIn_t &>(socketAddress);
         socket_address_in.length = sizeof(socket_address_in);
         socket_address_in.family = EMW_AF_INET;
-        socket_address_in.inAddr.addr = response_buffer.s_addr;
+        socket_address_in.inAddr.addr = cache_answer.sAddr.data2[0];
         status = 0;
       }
     }
+    else {
+      EmwCoreIpc::SocketGetHostByNameResponseParams_t response_buffer;
+      std::uint16_t response_buffer_size = sizeof(response_buffer);
+
+      STRING_COPY_TO_ARRAY_CHAR(command_data.getHostByNameParams.name, nameString);
+      if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
+          BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+        if (0 == response_buffer.status) {
+          /* Only for IPv4 address. */
+          EmwAddress::SockAddrIn_t &socket_address_in = reinterpret_cast<EmwAddress::SockAddrIn_t &>(socketAddress);
+          socket_address_in.length = sizeof(socket_address_in);
+          socket_address_in.family = EMW_AF_INET;
+          socket_address_in.inAddr.addr = response_buffer.s_addr;
+          cache_answer.family = EMW_AF_INET;
+          cache_answer.sAddr.data2[0] = response_buffer.s_addr;
+          this->dnsCache.store(nameString, EmwDnsCache::eHOST_BY_NAME, cache_hints, &cache_answer);
+          status = 0;
+        }
+        else {
+          this->dnsCache.store(nameString, EmwDnsCache::eHOST_BY_NAME, cache_hints, nullptr);
+        }
+      }
+    }
   }
   DEBUG_API_LOG(" EmwApiEmw::socketGetHostByName()< %" PRIi32 "\n\n", status)
   return status;
 }
 
+std::int32_t EmwApiEmw::socketGetPeerName(std::int32_t socketFd,
+    EmwAddress::SockAddr_t &socketAddress, std::uint32_t &socketAddressLength) noexcept
+{
+  std::int32_t status = -4;
+
+  DEBUG_API_LOG("\n EmwApiEmw::socketGetPeerName()>\n")
+
+  if (0 <= socketFd) {
+    EmwCoreIpc::IpcSocketGetPeerNameParams_t command_data;
+    EmwCoreIpc::SocketGetPeerNameResponseParams_t response_buffer;
+    std::uint16_t response_buffer_size = sizeof(response_buffer);
+
+    status = -1;
+    command_data.getPeerNameParams.sockfd = socketFd;
+    if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
+        BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+      if ((0 == response_buffer.status) \
+          && socketAddress_FromPacked(response_buffer.name, socketAddress, socketAddressLength)) {
+        status = 0;
+      }
+    }
+  }
+  DEBUG_API_LOG(" EmwApiEmw::socketGetPeerName()< %" PRIi32 "\n\n", status)
+  return status;
+}
+
+std::int32_t EmwApiEmw::socketGetSockName(std::int32_t socketFd,
+    EmwAddress::SockAddr_t &socketAddress, std::uint32_t &socketAddressLength) noexcept
+{
+  std::int32_t status = -4;
+
+  DEBUG_API_LOG("\n EmwApiEmw::socketGetSockName()>\n")
+
+  if (0 <= socketFd) {
+    EmwCoreIpc::IpcSocketGetSockNameParams_t command_data;
+    EmwCoreIpc::SocketGetSockNameResponseParams_t response_buffer;
+    std::uint16_t response_buffer_size = sizeof(response_buffer);
+
+    status = -1;
+    command_data.getSockNameParams.sockfd = socketFd;
+    if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
+        BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+      if ((0 == response_buffer.status) \
+          && socketAddress_FromPacked(response_buffer.name, socketAddress, socketAddressLength)) {
+        status = 0;
+      }
+    }
+  }
+  DEBUG_API_LOG(" EmwApiEmw::socketGetSockName()< %" PRIi32 "\n\n", status)
+  return status;
+}
+
 std::int32_t EmwApiEmw::socketGetSockOpt(std::int32_t socketFd, std::int32_t level,
     std::int32_t optionName, void *optionValuePtr, std::uint32_t &optionLength) noexcept
 {
@@ -233,6 +392,29 @@ std::int32_t EmwApiEmw::socketGetSockOpt(std::int32_t socketFd, std::int32_t lev
   return status;
 }
 
+std::int32_t EmwApiEmw::socketListen(std::int32_t socketFd, std::int32_t backlog) noexcept
+{
+  std::int32_t status = -4;
+
+  DEBUG_API_LOG("\n EmwApiEmw::socketListen()>\n")
+
+  if (0 <= socketFd) {
+    EmwCoreIpc::IpcSocketListenParams_t command_data(socketFd, backlog);
+    EmwCoreIpc::SocketListenResponseParams_t response_buffer;
+    std::uint16_t response_buffer_size = sizeof(response_buffer);
+
+    status = -1;
+    if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
+        BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+      if (0 == response_buffer.status) {
+        status = 0;
+      }
+    }
+  }
+  DEBUG_API_LOG(" EmwApiEmw::socketListen()< %" PRIi32 "\n\n", status)
+  return status;
+}
+
 std::int32_t EmwApiEmw::socketPing(const char (&hostnameString)[255],
                                    std::int32_t count, std::int32_t delayInMs, std::int32_t (&responses)[10]) noexcept
 {
@@ -249,6 +431,60 @@ std::int32_t EmwApiEmw::socketPing6(const char (&hostnameString)[255],
   return this->doSocketPing(EmwCoreIpc::eWIFI_PING6_CMD, hostnameString, count, delayInMs, responses);
 }
 
+std::int32_t EmwApiEmw::socketSelect(std::int32_t nfds, EmwFdSet_t *readFdsPtr, EmwFdSet_t *writeFdsPtr,
+                                     EmwFdSet_t *exceptFdsPtr, const EmwTimeVal_t &timeout) noexcept
+{
+  std::int32_t status = -4;
+
+  DEBUG_API_LOG("\n EmwApiEmw::socketSelect()> %" PRIi32 "\n", nfds)
+
+  if ((0 < nfds) && (static_cast<std::uint32_t>(nfds) <= EMW_FD_SETSIZE) && (0 <= timeout.seconds)
+      && (0 <= timeout.microSeconds)) {
+    EmwCoreIpc::IpcSocketSelectParams_t command_data;
+    EmwCoreIpc::SocketSelectResponseParams_t response_buffer;
+    std::uint16_t response_buffer_size = sizeof(response_buffer);
+    /* The module answers at the latest when the select times out. */
+    const std::uint32_t timeout_in_ms = (static_cast<std::uint32_t>(timeout.seconds) * 1000U) \
+                                        + (static_cast<std::uint32_t>(timeout.microSeconds) / 1000U);
+
+    status = -1;
+    command_data.selectParams.nfds = nfds;
+    if (nullptr != readFdsPtr) {
+      command_data.selectParams.readFds = *readFdsPtr;
+    }
+    if (nullptr != writeFdsPtr) {
+      command_data.selectParams.writeFds = *writeFdsPtr;
+    }
+    if (nullptr != exceptFdsPtr) {
+      command_data.selectParams.exceptFds = *exceptFdsPtr;
+    }
+    command_data.selectParams.timeout = timeout;
+    if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
+        BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT + timeout_in_ms)) {
+      status = response_buffer.status;
+      if (0 <= status) {
+        if (nullptr != readFdsPtr) {
+          *readFdsPtr = response_buffer.readFds;
+        }
+        if (nullptr != writeFdsPtr) {
+          *writeFdsPtr = response_buffer.writeFds;
+        }
+        if (nullptr != exceptFdsPtr) {
+          *exceptFdsPtr = response_buffer.exceptFds;
+        }
+      }
+    }
+  }
+  DEBUG_API_LOG(" EmwApiEmw::socketSelect()< %" PRIi32 "\n\n", status)
+  return status;
+}
+
+std::int32_t EmwApiEmw::socketWaitReady(std::int32_t socketFd, std::uint32_t events,
+                                        std::uint32_t timeoutInMs) noexcept
+{
+  return this->socketWatcher.waitReady(socketFd, events, timeoutInMs);
+}
+
 std::int32_t EmwApiEmw::socketSend(std::int32_t socketFd, const std::uint8_t (&data)[], std::int32_t dataLength,
                                    std::int32_t flags) noexcept
 {
@@ -275,7 +511,7 @@ std::int32_t EmwApiEmw::socketSend(std::int32_t socketFd, const std::uint8_t (&d
 
       command_data_ptr->ipcParams = ipc_params;
       command_data_ptr->sendParams.socket = socketFd;
-      (void) std::memcpy(&command_data_ptr->sendParams.buffer[0], data, data_length);
+      (void) EMW_MEMCPY(&command_data_ptr->sendParams.buffer[0], data, data_length);
       command_data_ptr->sendParams.size = data_length;
       command_data_ptr->sendParams.flags = flags;
       if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(command_data_ptr.get()), command_data_size,
@@ -288,6 +524,115 @@ std::int32_t EmwApiEmw::socketSend(std::int32_t socketFd, const std::uint8_t (&d
   return status;
 }
 
+/* Posts the data by chunks without waiting for each response, so that up to EMW_IPC_POST_WINDOW_SIZE chunks
+ * are in flight. The command data is filled but the size and the bytes of each chunk.
+ * The responses come in order, the length returned is the one accepted by the module up to the first failure.
+ */
+template<typename T> std::int32_t EmwApiEmw::postSendChunks(T &commandData, std::size_t chunkLengthMax,
+    const std::uint8_t (&data)[], std::size_t dataLength) noexcept
+{
+  EmwCoreIpc::PostResult_t result;
+  std::size_t posted_length = 0U;
+
+  while ((posted_length < dataLength) && !EmwCoreIpc::IsPostFailed(result)) {
+    const std::size_t remaining_length = dataLength - posted_length;
+    const std::size_t chunk_length = (remaining_length < chunkLengthMax) ? remaining_length : chunkLengthMax;
+    const std::uint16_t command_data_size = static_cast<std::uint16_t>(sizeof(T) - 1U + chunk_length);
+
+    (void) EMW_MEMCPY(&commandData.sendParams.buffer[0], &data[posted_length], chunk_length);
+    commandData.sendParams.size = chunk_length;
+    if (EmwCoreIpc::eSUCCESS != this->EmwCoreIpc::post(BYTES_ARRAY_REF(&commandData), command_data_size,
+        EMW_CMD_TIMEOUT, &result, static_cast<std::int32_t>(chunk_length))) {
+      break;
+    }
+    posted_length += chunk_length;
+  }
+  this->EmwCoreIpc::waitPosted(result, EMW_CMD_TIMEOUT);
+  return (0 < result.total) ? result.total : -1;
+}
+
+std::int32_t EmwApiEmw::socketSendAll(std::int32_t socketFd, const std::uint8_t (&data)[], std::int32_t dataLength,
+                                      std::int32_t flags) noexcept
+{
+  std::int32_t status = -4;
+
+  DEBUG_API_LOG("\n EmwApiEmw::socketSendAll()> %" PRIi32 "\n", dataLength)
+
+  if ((0 <= socketFd) && (0 < dataLength)) {
+    const std::size_t data_length = static_cast<std::size_t>(dataLength);
+    const std::size_t chunk_length_max \
+      = EmwNetworkStack::NETWORK_BUFFER_SIZE - (sizeof(EmwCoreIpc::IpcSocketSendParams_t) - 1U);
+    const std::size_t allocated_chunk_length = (data_length < chunk_length_max) ? data_length : chunk_length_max;
+    /* A single command buffer is filled for all the chunks, the IPC copies each posted command. */
+    std::unique_ptr<EmwCoreIpc::IpcSocketSendParams_t, decltype(&EmwOsInterface::Free)> \
+    command_data_ptr(static_cast<EmwCoreIpc::IpcSocketSendParams_t *>\
+                     (EmwOsInterface::Malloc(sizeof(EmwCoreIpc::IpcSocketSendParams_t) - 1U + allocated_chunk_length)),
+                     &EmwOsInterface::Free);
+
+    status = -1;
+    if (nullptr != command_data_ptr) {
+      const EmwCoreIpc::CmdParams_s ipc_params(EmwCoreIpc::eSOCKET_SEND_CMD);
+
+      command_data_ptr->ipcParams = ipc_params;
+      command_data_ptr->sendParams.socket = socketFd;
+      command_data_ptr->sendParams.flags = flags;
+      status = this->postSendChunks(*command_data_ptr, allocated_chunk_length, data, data_length);
+    }
+  }
+  DEBUG_API_LOG(" EmwApiEmw::socketSendAll()< %" PRIi32 "\n\n", status)
+  return status;
+}
+
+std::int32_t EmwApiEmw::socketSendTo(std::int32_t socketFd, const std::uint8_t (&data)[], std::int32_t dataLength,
+                                     std::int32_t flags,
+                                     const EmwAddress::SockAddr_t &toAddress, std::int32_t toAddressLength) noexcept
+{
+  std::int32_t status = -4;
+
+  DEBUG_API_LOG("\n EmwApiEmw::socketSendTo()> %" PRIi32 "\n", dataLength)
+
+  if ((0 <= socketFd) && (0 < dataLength) && (0 < toAddressLength)) {
+    EmwAddress::SockAddrStorage_t to_address_storage;
+
+    status = -1;
+    if (socketAddress_ToPacked(toAddress, toAddressLength, to_address_storage)) {
+      EmwCoreIpc::SocketSendToResponseParams_t response_buffer;
+      std::uint16_t response_buffer_size = sizeof(response_buffer);
+      std::size_t data_length = static_cast<std::size_t>(dataLength);
+
+      /* A datagram cannot be split, the data in excess is lost as with a real UDP socket. */
+      if ((data_length + sizeof(EmwCoreIpc::IpcSocketSendToParams_t) - 1U) > EmwNetworkStack::NETWORK_BUFFER_SIZE) {
+        data_length = EmwNetworkStack::NETWORK_BUFFER_SIZE - (sizeof(EmwCoreIpc::IpcSocketSendToParams_t) - 1U);
+      }
+      {
+        const std::uint16_t command_data_size \
+          = static_cast<std::uint16_t>(sizeof(EmwCoreIpc::IpcSocketSendToParams_t) - 1U + data_length);
+        std::unique_ptr<EmwCoreIpc::IpcSocketSendToParams_t, decltype(&EmwOsInterface::Free)> \
+        command_data_ptr(static_cast<EmwCoreIpc::IpcSocketSendToParams_t *>\
+                         (EmwOsInterface::Malloc(command_data_size)), &EmwOsInterface::Free);
+
+        if (nullptr != command_data_ptr) {
+          const EmwCoreIpc::CmdParams_s ipc_params(EmwCoreIpc::eSOCKET_SENDTO_CMD);
+
+          command_data_ptr->ipcParams = ipc_params;
+          command_data_ptr->sendToParams.socket = socketFd;
+          command_data_ptr->sendToParams.size = data_length;
+          command_data_ptr->sendToParams.flags = flags;
+          command_data_ptr->sendToParams.addr = to_address_storage;
+          command_data_ptr->sendToParams.length = static_cast<EmwAddress::SockLen_t>(toAddressLength);
+          (void) EMW_MEMCPY(&command_data_ptr->sendToParams.buffer[0], data, data_length);
+          if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(command_data_ptr.get()), command_data_size,
+              BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
+            status = response_buffer.sent;
+          }
+        }
+      }
+    }
+  }
+  DEBUG_API_LOG(" EmwApiEmw::socketSendTo()< %" PRIi32 "\n\n", status)
+  return status;
+}
+
 std::int32_t EmwApiEmw::socketSetSockOpt(std::int32_t socketFd, std::int32_t level,
     std::int32_t optionName, const void *optionValuePtr, std::int32_t optionLength) noexcept
 {
@@ -371,7 +716,7 @@ std::int32_t EmwApiEmw::socketReceive(std::int32_t socketFd, std::uint8_t (&buff
           const std::size_t received_len = static_cast<std::size_t>(response_buffer_ptr->received);
 
           if (received_len <= data_length) {
-            (void) std::memcpy(&buffer[0], &response_buffer_ptr->buffer[0], received_len);
+            (void) EMW_MEMCPY(&buffer[0], &response_buffer_ptr->buffer[0], received_len);
           }
         }
         status = response_buffer_ptr->received;
@@ -383,6 +728,60 @@ std::int32_t EmwApiEmw::socketReceive(std::int32_t socketFd, std::uint8_t (&buff
   return status;
 }
 
+std::size_t EmwApiEmw::SocketReceiveSizeMax(void) noexcept
+{
+  return EmwNetworkStack::NETWORK_IPC_PAYLOAD_SIZE - (sizeof(EmwCoreIpc::SocketReceiveResponseParams_t) - 1U);
+}
+
+std::int32_t EmwApiEmw::socketReceiveFrom(std::int32_t socketFd, std::uint8_t (&buffer)[], std::int32_t bufferLength,
+    std::int32_t flags,
+    EmwAddress::SockAddr_t &fromAddress, std::uint32_t &fromAddressLength) noexcept
+{
+  std::int32_t status = -4;
+
+  DEBUG_API_LOG("\n EmwApiEmw::socketReceiveFrom()> %" PRIi32 "\n", bufferLength)
+
+  if ((0 <= socketFd) && (0 < bufferLength)) {
+    std::size_t data_length = static_cast<std::size_t>(bufferLength);
+    std::uint16_t response_buffer_size;
+
+    status = -1;
+    if ((data_length + sizeof(EmwCoreIpc::SocketReceiveFromResponseParams_t) - 1U) >
+        EmwNetworkStack::NETWORK_IPC_PAYLOAD_SIZE) {
+      data_length = EmwNetworkStack::NETWORK_IPC_PAYLOAD_SIZE \
+                    - (sizeof(EmwCoreIpc::SocketReceiveFromResponseParams_t) - 1U);
+    }
+    response_buffer_size \
+      = static_cast<std::uint16_t>(sizeof(EmwCoreIpc::SocketReceiveFromResponseParams_t) - 1U + data_length);
+    {
+      std::unique_ptr<EmwCoreIpc::SocketReceiveFromResponseParams_t, decltype(&EmwOsInterface::Free)> \
+      response_buffer_ptr(static_cast<EmwCoreIpc::SocketReceiveFromResponseParams_t *> \
+                          (EmwOsInterface::Malloc(response_buffer_size)), &EmwOsInterface::Free);
+
+      if (nullptr != response_buffer_ptr) {
+        EmwCoreIpc::IpcSocketReceiveFromParams_t command_data(socketFd, data_length, flags);
+
+        response_buffer_ptr->received = 0;
+        if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(&command_data), sizeof(command_data),
+            BYTES_ARRAY_REF(response_buffer_ptr.get()), response_buffer_size, EMW_CMD_TIMEOUT)) {
+          if (response_buffer_ptr->received > 0) {
+            const std::size_t received_len = static_cast<std::size_t>(response_buffer_ptr->received);
+
+            if (received_len <= data_length) {
+              (void) EMW_MEMCPY(&buffer[0], &response_buffer_ptr->buffer[0], received_len);
+            }
+            (void) socketAddress_FromPacked(response_buffer_ptr->addr, fromAddress, fromAddressLength);
+          }
+          status = response_buffer_ptr->received;
+        }
+      }
+    }
+  }
+  DEBUG_API_LOG(" EmwApiEmw::socketReceiveFrom()< %" PRIi32 "\n\n", status)
+
+  return status;
+}
+
 std::int32_t EmwApiEmw::tlsSetVersion(EmwApiEmw::TlsVersion version) noexcept
 {
   std::int32_t status = -1;
@@ -413,7 +812,13 @@ std::int32_t EmwApiEmw::tlsSetClientCertificate(const std::uint8_t (&certificate
   if ((0U == certificateLength) || (command_data_size > EmwNetworkStack::NETWORK_IPC_PAYLOAD_SIZE)) {
     status = -4;
   }
+  else if (this->credentialCache.isUploaded(EmwCredentialCache::eTLS_CLIENT_CERTIFICATE, &certificate[0],
+                                            certificateLength)) {
+    /* Unchanged since the last upload, the module still has it. */
+    status = 0;
+  }
   else {
+    const std::uint32_t tick_start = HAL_GetTick();
     EmwCoreIpc::TlsSetClientCertificateResponseParams_t response_buffer;
     std::uint16_t response_buffer_size = sizeof(response_buffer);
     const std::uint16_t command_ipc_data_size = sizeof(EmwCoreIpc::CmdParams_t) + command_data_size;
@@ -428,9 +833,12 @@ std::int32_t EmwApiEmw::tlsSetClientCertificate(const std::uint8_t (&certificate
     command_data_ptr->setClientCertificateParams.privateKeyPemSize = 0U;
     (void) std::memcpy(&command_data_ptr->setClientCertificateParams.certificateData[0], certificate, certificateLength);
 
+    this->credentialCache.invalidate(EmwCredentialCache::eTLS_CLIENT_CERTIFICATE);
     if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(command_data_ptr.get()), command_ipc_data_size,
         BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
       if (0 == response_buffer.status) {
+        this->credentialCache.setUploaded(EmwCredentialCache::eTLS_CLIENT_CERTIFICATE, &certificate[0],
+                                          certificateLength, HAL_GetTick() - tick_start);
         status = 0;
       }
     }
@@ -452,7 +860,13 @@ std::int32_t EmwApiEmw::tlsSetClientPrivateKey(const std::uint8_t (&privateKey)[
   if ((privateKeyLength == 0U) || (command_data_size > EmwNetworkStack::NETWORK_IPC_PAYLOAD_SIZE)) {
     status = -4;
   }
+  else if (this->credentialCache.isUploaded(EmwCredentialCache::eTLS_CLIENT_PRIVATE_KEY, &privateKey[0],
+                                            privateKeyLength)) {
+    /* Unchanged since the last upload, the module still has it. */
+    status = 0;
+  }
   else {
+    const std::uint32_t tick_start = HAL_GetTick();
     EmwCoreIpc::TlsSetClientCertificateResponseParams_t response_buffer;
     std::uint16_t response_buffer_size = sizeof(response_buffer);
     const std::uint16_t command_ipc_data_size = sizeof(EmwCoreIpc::CmdParams_t) + command_data_size;
@@ -468,9 +882,12 @@ std::int32_t EmwApiEmw::tlsSetClientPrivateKey(const std::uint8_t (&privateKey)[
     (void) std::memcpy(&command_data_ptr->setClientCertificateParams.certificateData[0],
                        privateKey, privateKeyLength);
 
+    this->credentialCache.invalidate(EmwCredentialCache::eTLS_CLIENT_PRIVATE_KEY);
     if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(command_data_ptr.get()), command_ipc_data_size,
         BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
       if (0 == response_buffer.status) {
+        this->credentialCache.setUploaded(EmwCredentialCache::eTLS_CLIENT_PRIVATE_KEY, &privateKey[0],
+                                          privateKeyLength, HAL_GetTick() - tick_start);
         status = EmwApiBase::eEMW_STATUS_OK;
       }
     }
@@ -584,7 +1001,7 @@ std::int32_t EmwApiEmw::tlsSend(EmwApiBase::Mtls_t tlsPtr, const std::uint8_t (&
 
       command_data_ptr->ipcParams = ipc_params;
       command_data_ptr->sendParams.tlsPtr = tlsPtr;
-      (void) std::memcpy(&command_data_ptr->sendParams.buffer[0], data, data_length);
+      (void) EMW_MEMCPY(&command_data_ptr->sendParams.buffer[0], data, data_length);
       command_data_ptr->sendParams.size = data_length;
 
       if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(command_data_ptr.get()), command_ipc_data_size,
@@ -598,6 +1015,41 @@ std::int32_t EmwApiEmw::tlsSend(EmwApiBase::Mtls_t tlsPtr, const std::uint8_t (&
   return status;
 }
 
+std::int32_t EmwApiEmw::tlsSendAll(EmwApiBase::Mtls_t tlsPtr, const std::uint8_t (&data)[],
+                                   std::int32_t dataLength) noexcept
+{
+  std::int32_t status = -4;
+
+  DEBUG_API_LOG("\n EmwApiEmw::tlsSendAll()> tls: %p\n", tlsPtr)
+
+  if ((nullptr == tlsPtr) || (dataLength <= 0)) {
+    status = -1;
+  }
+  else {
+    const std::size_t data_length = static_cast<std::size_t>(dataLength);
+    const std::size_t chunk_length_max \
+      = EmwNetworkStack::NETWORK_IPC_PAYLOAD_SIZE - (sizeof(EmwCoreIpc::IpcTlsSendParams_t) - 1U);
+    const std::size_t allocated_chunk_length = (data_length < chunk_length_max) ? data_length : chunk_length_max;
+    /* A single command buffer is filled for all the chunks, the IPC copies each posted command. */
+    std::unique_ptr<EmwCoreIpc::IpcTlsSendParams_t, decltype(&EmwOsInterface::Free)> \
+    command_data_ptr(static_cast<EmwCoreIpc::IpcTlsSendParams_t *>\
+                     (EmwOsInterface::Malloc(sizeof(EmwCoreIpc::IpcTlsSendParams_t) - 1U + allocated_chunk_length)),
+                     &EmwOsInterface::Free);
+
+    status = -1;
+    if (nullptr != command_data_ptr) {
+      const EmwCoreIpc::CmdParams_s ipc_params(EmwCoreIpc::eTLS_SEND_CMD);
+
+      command_data_ptr->ipcParams = ipc_params;
+      command_data_ptr->sendParams.tlsPtr = tlsPtr;
+      status = this->postSendChunks(*command_data_ptr, allocated_chunk_length, data, data_length);
+    }
+  }
+  DEBUG_API_LOG(" EmwApiEmw::tlsSendAll()< %" PRIi32 "\n\n", status)
+
+  return status;
+}
+
 std::int32_t EmwApiEmw::tlsReceive(EmwApiBase::Mtls_t tlsPtr, std::uint8_t (&data)[], std::int32_t dataLength) noexcept
 {
   std::int32_t status;
@@ -632,7 +1084,7 @@ std::int32_t EmwApiEmw::tlsReceive(EmwApiBase::Mtls_t tlsPtr, std::uint8_t (&dat
         if (response_buffer_ptr->received > 0) {
           const std::size_t received_len = response_buffer_ptr->received;
           if (received_len <= data_length) {
-            (void) std::memcpy(data, &response_buffer_ptr->buffer[0], received_len);
+            (void) EMW_MEMCPY(data, &response_buffer_ptr->buffer[0], received_len);
           }
         }
         status = response_buffer_ptr->received;
@@ -729,6 +1181,64 @@ std::int32_t EmwApiEmw::doSocketPing(std::uint16_t apiId,
   return status;
 }
 
+void EmwApiEmw::socketAddrInfo_FromCache(const EmwDnsCache::Answer_t &answer, EmwAddress::AddrInfo_t &result) noexcept
+{
+  result.flags = answer.flags;
+  result.family = answer.family;
+  result.sockType = answer.sockType;
+  result.protocol = answer.protocol;
+  result.addrLen = answer.addrLen;
+  result.sAddr.length = answer.sAddr.length;
+  result.sAddr.family = answer.sAddr.family;
+  /* Keep port possibly set as it is. */
+  result.sAddr.data2[0] = answer.sAddr.data2[0];
+  result.sAddr.data2[1] = answer.sAddr.data2[1];
+  result.sAddr.data2[2] = answer.sAddr.data2[2];
+  result.sAddr.data3[0] = answer.sAddr.data3[0];
+  result.sAddr.data3[1] = answer.sAddr.data3[1];
+  result.sAddr.data3[2] = answer.sAddr.data3[2];
+  (void) std::memcpy(result.canonName, answer.canonName, sizeof(answer.canonName));
+}
+
+bool EmwApiEmw::socketAddress_FromPacked(const EmwAddress::SockAddrStorage_t &socketAddressPacked,
+    EmwAddress::SockAddr_t &socketAddress, std::uint32_t &socketAddressLength) noexcept
+{
+  bool status = true;
+
+  /* The caller storage must be large enough for the family of the address. */
+  if ((EMW_AF_INET == socketAddressPacked.family) && (socketAddressLength >= sizeof(EmwAddress::SockAddrIn_t))) {
+    reinterpret_cast<EmwAddress::SockAddrIn_t &>(socketAddress) = socketAddressIn_FromPacked(socketAddressPacked);
+    socketAddressLength = sizeof(EmwAddress::SockAddrIn_t);
+  }
+  else if ((EMW_AF_INET6 == socketAddressPacked.family) \
+           && (socketAddressLength >= sizeof(EmwAddress::SockAddrIn6_t))) {
+    reinterpret_cast<EmwAddress::SockAddrIn6_t &>(socketAddress) = socketAddressIn6_FromPacked(socketAddressPacked);
+    socketAddressLength = sizeof(EmwAddress::SockAddrIn6_t);
+  }
+  else {
+    socketAddressLength = 0U;
+    status = false;
+  }
+  return status;
+}
+
+bool EmwApiEmw::socketAddress_ToPacked(const EmwAddress::SockAddr_t &socketAddress, std::int32_t socketAddressLength,
+                                       EmwAddress::SockAddrStorage_t &socketAddressPacked) noexcept
+{
+  bool status = true;
+
+  if ((EMW_AF_INET == socketAddress.family) && (socketAddressLength == sizeof(EmwAddress::SockAddrIn_t))) {
+    socketAddressPacked = socketAddressIn_ToPacked(socketAddress);
+  }
+  else if ((EMW_AF_INET6 == socketAddress.family) && (socketAddressLength == sizeof(EmwAddress::SockAddrIn6_t))) {
+    socketAddressPacked = socketAddressIn6_ToPacked(socketAddress);
+  }
+  else {
+    status = false;
+  }
+  return status;
+}
+
 EmwAddress::SockAddrIn_t EmwApiEmw::socketAddressIn_FromPacked(const EmwAddress::SockAddrStorage_t &socketAddress)
 noexcept
 {
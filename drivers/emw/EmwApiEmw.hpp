@@ -21,6 +21,9 @@
 #include "EmwAddress.hpp"
 #include "EmwApiBase.hpp"
 #include "EmwApiCore.hpp"
+#include "EmwDnsCache.hpp"
+#include "EmwSocketWatcher.hpp"
+#include <cstddef>
 #include <cstdint>
 
 class EmwApiEmw final : public EmwApiCore {
@@ -30,6 +33,12 @@ class EmwApiEmw final : public EmwApiCore {
     explicit EmwApiEmw(const EmwApiEmw& other) = delete;
   public:
     ~EmwApiEmw(void) noexcept override;
+  public:
+    std::int32_t socketAccept(std::int32_t socketFd,
+                              EmwAddress::SockAddr_t &socketAddress, std::uint32_t &socketAddressLength) noexcept;
+  public:
+    std::int32_t socketBind(std::int32_t socketFd,
+                            const EmwAddress::SockAddr_t &socketAddress, std::int32_t socketAddressLength) noexcept;
   public:
     std::int32_t socketClose(std::int32_t socketFd) noexcept;
   public:
@@ -38,13 +47,28 @@ class EmwApiEmw final : public EmwApiCore {
     std::int32_t socketConnect(std::int32_t socketFd,
                                const EmwAddress::SockAddr_t &socketAddress, std::int32_t socketAddressLength) noexcept;
   public:
+    void flushDnsCache(void) noexcept;
+  public:
+    void getDnsCacheStatistics(EmwDnsCache::Statistics_t &statistics) const noexcept;
+  public:
+    /* Without the DNS cache, the module is always requested and its answer refreshes the cache. */
     std::int32_t socketGetAddrInfo(const char (&nodeNameString)[255], const char (&serviceNameString)[255],
-                                   const EmwAddress::AddrInfo_t &hints, EmwAddress::AddrInfo_t &result) noexcept;
+                                   const EmwAddress::AddrInfo_t &hints, EmwAddress::AddrInfo_t &result,
+                                   bool useDnsCache = true) noexcept;
+  public:
+    std::int32_t socketGetHostByName(EmwAddress::SockAddr_t &socketAddress, const char (&nameString)[255],
+                                     bool useDnsCache = true) noexcept;
+  public:
+    std::int32_t socketGetPeerName(std::int32_t socketFd,
+                                   EmwAddress::SockAddr_t &socketAddress, std::uint32_t &socketAddressLength) noexcept;
   public:
-    std::int32_t socketGetHostByName(EmwAddress::SockAddr_t &socketAddress, const char (&nameString)[255]) noexcept;
+    std::int32_t socketGetSockName(std::int32_t socketFd,
+                                   EmwAddress::SockAddr_t &socketAddress, std::uint32_t &socketAddressLength) noexcept;
   public:
     std::int32_t socketGetSockOpt(std::int32_t socketFd, std::int32_t level,
                                   std::int32_t optionName, void *optionValuePtr, std::uint32_t &optionLength) noexcept;
+  public:
+    std::int32_t socketListen(std::int32_t socketFd, std::int32_t backlog) noexcept;
   public:
     std::int32_t socketPing(const char (&hostnameString)[255],
                             std::int32_t count, std::int32_t delayInMs, std::int32_t (&responses)[10]) noexcept;
@@ -52,9 +76,23 @@ class EmwApiEmw final : public EmwApiCore {
     std::int32_t socketPing6(const char (&hostnameString)[255],
                              std::int32_t count, std::int32_t delayInMs, std::int32_t (&responses)[10]) noexcept;
 
+  public:
+    std::int32_t socketSelect(std::int32_t nfds, EmwFdSet_t *readFdsPtr, EmwFdSet_t *writeFdsPtr,
+                              EmwFdSet_t *exceptFdsPtr, const EmwTimeVal_t &timeout) noexcept;
+  public:
+    /* Waits for EmwSocketWatcher events on a socket without polling it, returns the ready events. */
+    std::int32_t socketWaitReady(std::int32_t socketFd, std::uint32_t events, std::uint32_t timeoutInMs) noexcept;
   public:
     std::int32_t socketSend(std::int32_t socketFd, const std::uint8_t (&data)[], std::int32_t dataLength,
                             std::int32_t flags) noexcept;
+  public:
+    /* Sends the whole buffer, in IPC sized chunks posted without waiting for each response, returns the total sent. */
+    std::int32_t socketSendAll(std::int32_t socketFd, const std::uint8_t (&data)[], std::int32_t dataLength,
+                               std::int32_t flags) noexcept;
+  public:
+    std::int32_t socketSendTo(std::int32_t socketFd, const std::uint8_t (&data)[], std::int32_t dataLength,
+                              std::int32_t flags,
+                              const EmwAddress::SockAddr_t &toAddress, std::int32_t toAddressLength) noexcept;
   public:
     std::int32_t socketSetSockOpt(std::int32_t socketFd, std::int32_t level,
                                   std::int32_t optionName, const void *optionValuePtr, std::int32_t optionLength) noexcept;
@@ -63,6 +101,12 @@ class EmwApiEmw final : public EmwApiCore {
   public:
     std::int32_t socketReceive(std::int32_t socketFd, uint8_t (&buffer)[], std::int32_t bufferLength,
                                std::int32_t flags) noexcept;
+  public:
+    static std::size_t SocketReceiveSizeMax(void) noexcept;
+  public:
+    std::int32_t socketReceiveFrom(std::int32_t socketFd, std::uint8_t (&buffer)[], std::int32_t bufferLength,
+                                   std::int32_t flags,
+                                   EmwAddress::SockAddr_t &fromAddress, std::uint32_t &fromAddressLength) noexcept;
   public:
     enum /*class*/ TlsVersion : std::uint8_t {
       SSL_V3_MODE = 1,
@@ -87,6 +131,9 @@ class EmwApiEmw final : public EmwApiCore {
                                const char (&caString)[2500], std::int32_t caStringLength) noexcept;
   public:
     std::int32_t tlsSend(EmwApiBase::Mtls_t, const std::uint8_t (&data)[], std::int32_t dataLength) noexcept;
+  public:
+    /* Sends the whole buffer, in IPC sized chunks posted without waiting for each response, returns the total sent. */
+    std::int32_t tlsSendAll(EmwApiBase::Mtls_t, const std::uint8_t (&data)[], std::int32_t dataLength) noexcept;
   public:
     std::int32_t tlsReceive(EmwApiBase::Mtls_t, std::uint8_t (&data)[], std::int32_t dataLength) noexcept;
   public:
@@ -98,6 +145,17 @@ class EmwApiEmw final : public EmwApiCore {
     std::int32_t doSocketPing(std::uint16_t apiId,
                               const char (&hostnameString)[255],
                               std::int32_t count, std::int32_t delayInMs, std::int32_t (&responses)[10]) noexcept;
+  private:
+    template<typename T> std::int32_t postSendChunks(T &commandData, std::size_t chunkLengthMax,
+        const std::uint8_t (&data)[], std::size_t dataLength) noexcept;
+  private:
+    static void socketAddrInfo_FromCache(const EmwDnsCache::Answer_t &answer, EmwAddress::AddrInfo_t &result) noexcept;
+  private:
+    static bool socketAddress_FromPacked(const EmwAddress::SockAddrStorage_t &socketAddressPacked,
+                                         EmwAddress::SockAddr_t &socketAddress, std::uint32_t &socketAddressLength) noexcept;
+  private:
+    static bool socketAddress_ToPacked(const EmwAddress::SockAddr_t &socketAddress, std::int32_t socketAddressLength,
+                                       EmwAddress::SockAddrStorage_t &socketAddressPacked) noexcept;
   private:
     static EmwAddress::SockAddrIn_t socketAddressIn_FromPacked(const EmwAddress::SockAddrStorage_t &socketAddress) noexcept;
   private:
@@ -107,4 +165,7 @@ class EmwApiEmw final : public EmwApiCore {
     static EmwAddress::SockAddrStorage_t socketAddressIn_ToPacked(const EmwAddress::SockAddr_t &socketAddress) noexcept;
   private:
     static EmwAddress::SockAddrStorage_t socketAddressIn6_ToPacked(const EmwAddress::SockAddr_t &socketAddress) noexcept;
+
+  private:
+    EmwSocketWatcher socketWatcher;
 };
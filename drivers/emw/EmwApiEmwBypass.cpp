@@ -68,6 +68,11 @@ EmwApiBase::Status EmwApiEmwBypass::setByPass(std::int32_t enable,
   return status;
 }
 
+void EmwApiEmwBypass::getOutputStatistics(EmwCoreIpc::PostStatistics_t &statistics) const noexcept
+{
+  EmwCoreIpc::GetPostStatistics(statistics);
+}
+
 EmwApiBase::Status EmwApiEmwBypass::output(std::uint8_t *dataPtr, std::uint16_t dataLength,
     std::uint32_t interface) noexcept
 {
@@ -91,18 +96,14 @@ EmwApiBase::Status EmwApiEmwBypass::output(std::uint8_t *dataPtr, std::uint16_t
       EmwCoreIpc::IpcWiFiBypassOutParams_t *command_data_ptr \
         = reinterpret_cast<EmwCoreIpc::IpcWiFiBypassOutParams_t *>(dataPtr - sizeof(EmwCoreIpc::IpcWiFiBypassOutParams_t));
       const EmwCoreIpc::CmdParams_s ipc_params(EmwCoreIpc::EmwCoreIpc::eWIFI_BYPASS_OUT_CMD);
-      EmwCoreIpc::SysCommonResponseParams_t response_buffer;
-      std::uint16_t response_buffer_size = sizeof(response_buffer);
 
       command_data_ptr->ipcParams = ipc_params;
       command_data_ptr->bypassOutParams.idx = interface;
       command_data_ptr->bypassOutParams.dataLength = dataLength;
 
-      if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::request(BYTES_ARRAY_REF(command_data_ptr), command_data_size,
-          BYTES_ARRAY_REF(&response_buffer), response_buffer_size, EMW_CMD_TIMEOUT)) {
-        if (0 == response_buffer.status) {
-          status = EmwApiBase::eEMW_STATUS_OK;
-        }
+      if (EmwCoreIpc::eSUCCESS == this->EmwCoreIpc::post(BYTES_ARRAY_REF(command_data_ptr), command_data_size,
+          EMW_CMD_TIMEOUT)) {
+        status = EmwApiBase::eEMW_STATUS_OK;
       }
     }
   }
@@ -32,5 +32,8 @@ class EmwApiEmwBypass final : public EmwApiCore {
   public:
     EmwApiBase::Status setByPass(std::int32_t enable, EmwApiBase::NetlinkInputCallback_t netlinkInputCallback) noexcept;
   public:
+    void getOutputStatistics(EmwCoreIpc::PostStatistics_t &statistics) const noexcept;
+  public:
+    /* The frame is posted, the status of the module for it is only counted in the output statistics. */
     EmwApiBase::Status output(std::uint8_t *dataPtr, std::uint16_t dataLength, std::uint32_t interface) noexcept;
 };
@@ -36,26 +36,32 @@ void EmwCoreHci::Free(EmwNetworkStack::Buffer_t *networkBufferPtr) noexcept
   }
 }
 
+void EmwCoreHci::GetFifoStatistics(EmwCoreHci::NetworkPacketFifo_t::Statistics_t &statistics) noexcept
+{
+  EmwCoreHci::NetworkPacketFifo.getStatistics(statistics);
+}
+
 void EmwCoreHci::Initialize(void) noexcept
 {
   DEBUG_HCI_LOG("\n[%6" PRIu32 "] EmwCoreHci::Initialize()>\n", HAL_GetTick())
 
   EmwCoreHci::Io.initialize(EmwIoInterfaceTypes::eINITIALIZE);
   {
-    static const char network_packet_fifo_name[] = {"EMW-HciNetworkPacketFifo"};
-    EmwOsInterface::Status os_status = EmwOsInterface::CreateMessageQueue(EmwCoreHci::NetworkPacketFifo,
-                                       network_packet_fifo_name, EMW_HCI_MAX_RX_BUFFER_COUNT);
-    EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
+    static const char network_packet_fifo_data_name[] = {"EMW-HciNetworkPacketFifoData"};
+    static const char network_packet_fifo_space_name[] = {"EMW-HciNetworkPacketFifoSpace"};
+
+    EmwOsInterface::AssertAlways(EmwOsInterface::eOK \
+                                 == EmwCoreHci::NetworkPacketFifo.initialize(network_packet_fifo_data_name,
+                                     network_packet_fifo_space_name));
   }
 #if defined(EMW_WITH_NO_OS) && defined(EMW_USE_SPI_DMA)
   {
     /**
-      * The PollData() will be called when the caller enters
-      * the getMessageQueue() operation.
+      * The PollData() will be called when the caller waits
+      * for the FIFO to be filled.
       * It performs polling as the dedicated thread can do when using a RTOS.
       */
-    EmwOsInterface::AddMessageQueueHook(EmwCoreHci::NetworkPacketFifo,
-                                        EmwIoInterface<EmwIoSpi>::PollData, &EmwCoreHci::Io, nullptr);
+    (void) EmwCoreHci::NetworkPacketFifo.addConsumerHook(EmwIoInterface<EmwIoSpi>::PollData, &EmwCoreHci::Io, nullptr);
   }
 #endif /* EMW_WITH_NO_OS && EMW_USE_SPI_DMA */
   DEBUG_HCI_LOG("\n[%6" PRIu32 "] EmwCoreHci::Initialize()<\n", HAL_GetTick())
@@ -75,8 +81,7 @@ void EmwCoreHci::Input(EmwNetworkStack::Buffer_t *networkBufferPtr) noexcept
         DEBUG_HCI_LOG("%02" PRIx32 " ", static_cast<std::uint32_t>(*(buffer_payload_ptr + i)))
       }
 #endif /* 0 */
-      if (EmwOsInterface::eOK \
-          != EmwOsInterface::PutMessageQueue(EmwCoreHci::NetworkPacketFifo, networkBufferPtr, EMW_OS_TIMEOUT_FOREVER)) {
+      if (!EmwCoreHci::NetworkPacketFifo.put(networkBufferPtr, EMW_OS_TIMEOUT_FOREVER)) {
         DRIVER_ERROR_VERBOSE("HCI push input queue error!\n")
         EmwNetworkStack::FreeBuffer(networkBufferPtr);
       }
@@ -90,13 +95,9 @@ void EmwCoreHci::Input(EmwNetworkStack::Buffer_t *networkBufferPtr) noexcept
 
 EmwNetworkStack::Buffer_t *EmwCoreHci::Receive(std::uint32_t timeoutInMs) noexcept
 {
-  EmwNetworkStack::Buffer_t *network_buffer_ptr = nullptr;
-  const void *message_ptr = nullptr;
-  const EmwOsInterface::Status os_status \
-    = EmwOsInterface::GetMessageQueue(EmwCoreHci::NetworkPacketFifo, timeoutInMs, message_ptr);
+  EmwNetworkStack::Buffer_t *network_buffer_ptr = EmwCoreHci::NetworkPacketFifo.get(timeoutInMs);
 
-  if ((EmwOsInterface::eOK == os_status) && (nullptr != message_ptr)) {
-    network_buffer_ptr = reinterpret_cast<EmwNetworkStack::Buffer_t *>(const_cast<void*>(message_ptr));
+  if (nullptr != network_buffer_ptr) {
     EMW_STATS_INCREMENT(fifoOut)
 #if 0
     {
@@ -116,6 +117,11 @@ void EmwCoreHci::ResetIo(void) noexcept
   DEBUG_HCI_LOG("\n[%6" PRIu32 "] EmwCoreHci::ResetIo()<\n", HAL_GetTick())
 }
 
+bool EmwCoreHci::IsSending(const std::uint8_t *payloadPtr) noexcept
+{
+  return EmwCoreHci::Io.isSending(payloadPtr);
+}
+
 std::int32_t EmwCoreHci::Send(const std::uint8_t *payloadPtr, std::uint16_t payloadLength) noexcept
 {
   std::int32_t status = 0;
@@ -136,7 +142,7 @@ void EmwCoreHci::UnInitialize(void) noexcept
 {
   DEBUG_HCI_LOG("\n EmwCoreHci::UnInitialize()>\n")
 
-  EmwOsInterface::DeleteMessageQueue(EmwCoreHci::NetworkPacketFifo);
+  EmwCoreHci::NetworkPacketFifo.unInitialize();
   EmwCoreHci::Io.unInitialize();
 
   DEBUG_HCI_LOG("\n EmwCoreHci::UnInitialize()<\n")
@@ -147,4 +153,4 @@ class EmwIoSpi EmwCoreHci::IoSpi;
 class EmwIoInterface<EmwIoSpi> &EmwCoreHci::Io = EmwCoreHci::IoSpi;
 #endif /* EMW_USE_SPI_DMA) */
 
-EmwOsInterface::Queue_t EmwCoreHci::NetworkPacketFifo;
+EmwCoreHci::NetworkPacketFifo_t EmwCoreHci::NetworkPacketFifo;
@@ -24,16 +24,24 @@
 #endif /* EMW_USE_SPI_DMA) */
 #include "EmwNetworkStack.hpp"
 #include "EmwOsInterface.hpp"
+#include "EmwSpscRing.hpp"
 
 #include <cstdint>
 
 class EmwCoreHci final {
   private:
     EmwCoreHci(void) noexcept {};
+  public:
+    typedef EmwSpscRing<EmwNetworkStack::Buffer_t, EMW_HCI_MAX_RX_BUFFER_COUNT> NetworkPacketFifo_t;
+
   public:
     static void Free(EmwNetworkStack::Buffer_t *networkBufferPtr) noexcept;
+  public:
+    static void GetFifoStatistics(EmwCoreHci::NetworkPacketFifo_t::Statistics_t &statistics) noexcept;
   public:
     static void Initialize(void) noexcept;
+  public:
+    static bool IsSending(const std::uint8_t *payloadPtr) noexcept;
   public:
     static void Input(EmwNetworkStack::Buffer_t *networkBufferPtr) noexcept;
   public:
@@ -53,5 +61,6 @@ class EmwCoreHci final {
 #endif /* EMW_USE_SPI_DMA) */
 
   private:
-    static EmwOsInterface::Queue_t NetworkPacketFifo;
+    /* Written by the IO thread only, read by the receive thread only. */
+    static EmwCoreHci::NetworkPacketFifo_t NetworkPacketFifo;
 };
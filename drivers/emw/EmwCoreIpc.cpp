@@ -111,22 +111,211 @@ void EmwCoreIpc::initialize(void) noexcept
     EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
   }
   {
-    static const char response_sem_name[] = {"EMW-IpcResponseSem"};
+    static const char response_notification_name[] = {"EMW-IpcResponse"};
     const EmwOsInterface::Status os_status \
-      = EmwOsInterface::CreateSemaphore(EmwCoreIpc::PendingRequest.sem, response_sem_name, 1U, 0U);
+      = EmwOsInterface::CreateNotification(EmwCoreIpc::PendingRequest.notification, response_notification_name,
+                                           EMW_OS_NOTIFICATION_IPC_RESPONSE, 1U);
     EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
   }
 #if defined(EMW_WITH_NO_OS)
   {
     const EmwOsInterface::Status os_status \
-      = EmwOsInterface::AddSemaphoreHook(EmwCoreIpc::PendingRequest.sem, EmwCoreIpc::Poll, this, nullptr);
+      = EmwOsInterface::AddNotificationHook(EmwCoreIpc::PendingRequest.notification, EmwCoreIpc::Poll, this, nullptr);
     EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
   }
 #endif /* EMW_WITH_NO_OS */
+#if (EMW_IPC_POST_WINDOW_SIZE > 0)
+  {
+    static const char post_window_sem_name[] = {"EMW-IpcPostWindowSem"};
+    const EmwOsInterface::Status os_status \
+      = EmwOsInterface::CreateSemaphore(EmwCoreIpc::PostWindowSem, post_window_sem_name,
+                                        EMW_IPC_POST_WINDOW_SIZE, EMW_IPC_POST_WINDOW_SIZE);
+    EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
+  }
+#if defined(EMW_WITH_NO_OS)
+  {
+    const EmwOsInterface::Status os_status \
+      = EmwOsInterface::AddSemaphoreHook(EmwCoreIpc::PostWindowSem, EmwCoreIpc::Poll, this, nullptr);
+    EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
+  }
+#endif /* EMW_WITH_NO_OS */
+  for (EmwCoreIpc::PostedRequest_t &posted : EmwCoreIpc::PostedRequests) {
+    posted.reqId = REQ_ID_RESET_VAL;
+    posted.resultPtr = nullptr;
+  }
+#endif /* EMW_IPC_POST_WINDOW_SIZE */
   EmwCoreHci::Initialize();
   DEBUG_IPC_LOG("  EmwCoreIpc::initialize()<\n\n")
 }
 
+void EmwCoreIpc::GetPostStatistics(EmwCoreIpc::PostStatistics_t &statistics) noexcept
+{
+  EmwOsInterface::Lock();
+  statistics = EmwCoreIpc::PostStatistics;
+  EmwOsInterface::UnLock();
+}
+
+EmwCoreIpc::Status EmwCoreIpc::post(std::uint8_t (&commandData)[], std::uint16_t commandDataSize,
+                                    std::uint32_t timeoutInMs, EmwCoreIpc::PostResult_t *resultPtr,
+                                    std::int32_t expectedStatus) noexcept
+{
+  EmwCoreIpc::Status status = EmwCoreIpc::eERROR;
+
+  DEBUG_IPC_LOG("  EmwCoreIpc::post()> %" PRIu32 "\n", static_cast<std::uint32_t>(commandDataSize))
+
+  if (this->isUsable && (EmwCoreIpc::PACKET_MIN_SIZE <= commandDataSize) \
+      && (commandDataSize <= EmwNetworkStack::NETWORK_BUFFER_SIZE)) {
+#if (EMW_IPC_POST_WINDOW_SIZE > 0)
+    std::uint32_t time_left_in_ms = EmwCoreIpc::ReclaimPostedRequests();
+    bool is_slot_taken = (EmwOsInterface::eOK == EmwOsInterface::TakeSemaphore(EmwCoreIpc::PostWindowSem, 0U));
+
+    if (!is_slot_taken) {
+      const std::uint32_t tstart = HAL_GetTick();
+      std::uint32_t elapsed_in_ms = 0U;
+
+      EmwOsInterface::Lock();
+      EmwCoreIpc::PostStatistics.windowFull++;
+      EmwOsInterface::UnLock();
+      /* Waits for a response, or for the oldest posted request to be given up. */
+      while (!is_slot_taken && (elapsed_in_ms < timeoutInMs)) {
+        const std::uint32_t wait_in_ms = ((timeoutInMs - elapsed_in_ms) < time_left_in_ms) \
+                                         ? (timeoutInMs - elapsed_in_ms) : time_left_in_ms;
+
+        is_slot_taken = (EmwOsInterface::eOK == EmwOsInterface::TakeSemaphore(EmwCoreIpc::PostWindowSem, wait_in_ms));
+        if (!is_slot_taken) {
+          time_left_in_ms = EmwCoreIpc::ReclaimPostedRequests();
+          is_slot_taken = (EmwOsInterface::eOK == EmwOsInterface::TakeSemaphore(EmwCoreIpc::PostWindowSem, 0U));
+        }
+        elapsed_in_ms = HAL_GetTick() - tstart;
+      }
+    }
+    if (is_slot_taken) {
+      EmwScopedLock lock(EmwCoreIpc::IpcLock);
+      EmwCoreIpc::PostedRequest_t *posted_ptr = nullptr;
+      const std::uint32_t req_id = GetNewReqId();
+
+      EmwOsInterface::Lock();
+      for (EmwCoreIpc::PostedRequest_t &posted : EmwCoreIpc::PostedRequests) {
+        if (REQ_ID_RESET_VAL == posted.reqId) {
+          posted_ptr = &posted;
+          break;
+        }
+      }
+      EmwOsInterface::UnLock();
+      EmwOsInterface::AssertAlways(nullptr != posted_ptr);
+
+      /* The buffers of the window are kept until the IPC stops. */
+      if (nullptr == posted_ptr->bufferPtr) {
+        posted_ptr->bufferPtr = static_cast<std::uint8_t *>(EmwOsInterface::Malloc(EmwNetworkStack::NETWORK_BUFFER_SIZE));
+      }
+      if (nullptr == posted_ptr->bufferPtr) {
+        (void) EmwOsInterface::ReleaseSemaphore(EmwCoreIpc::PostWindowSem);
+        status = EmwCoreIpc::eNO_MEMORY;
+      }
+      else {
+        (void) EMW_MEMCPY(posted_ptr->bufferPtr, commandData, commandDataSize);
+        SetReqId(posted_ptr->bufferPtr, req_id);
+        posted_ptr->postTimeInMs = HAL_GetTick();
+        posted_ptr->timeoutInMs = timeoutInMs;
+        posted_ptr->resultPtr = resultPtr;
+        posted_ptr->expectedStatus = expectedStatus;
+        if (nullptr != resultPtr) {
+          EmwOsInterface::Lock();
+          resultPtr->pending++;
+          EmwOsInterface::UnLock();
+        }
+        posted_ptr->reqId = req_id;
+
+        if (EmwCoreIpc::IsPowerSaveEnabled) {
+          (void) EmwCoreHci::Send(reinterpret_cast<const std::uint8_t *>("dummy"), 5U);
+          EmwOsInterface::Delay(10U);
+        }
+        DEBUG_IPC_LOG("  EmwCoreIpc::post(): req_id: 0x%08" PRIx32 ", api_id: 0x%08" PRIx32 "\n",
+                      req_id, static_cast<std::uint32_t>(GetApiId(commandData)))
+
+        if (0 != this->sendCommand(posted_ptr->bufferPtr, commandDataSize, timeoutInMs)) {
+          DRIVER_ERROR_VERBOSE("IPC failed to send command to HCI\n")
+          EmwOsInterface::Lock();
+          posted_ptr->reqId = REQ_ID_RESET_VAL;
+          if (nullptr != resultPtr) {
+            resultPtr->pending--;
+          }
+          EmwOsInterface::UnLock();
+          (void) EmwOsInterface::ReleaseSemaphore(EmwCoreIpc::PostWindowSem);
+        }
+        else {
+          EmwOsInterface::Lock();
+          EmwCoreIpc::PostStatistics.posted++;
+          EmwOsInterface::UnLock();
+          status = EmwCoreIpc::eSUCCESS;
+        }
+      }
+    }
+    else {
+      DRIVER_ERROR_VERBOSE("IPC no response to the posted commands\n")
+      status = EmwCoreIpc::eTIMEOUT;
+    }
+#else
+    /* Without window, the command is a request whose response status is only counted. */
+    EmwCoreIpc::SysCommonResponseParams_t response_buffer;
+    std::uint16_t response_buffer_size = sizeof(response_buffer);
+
+    status = this->request(commandData, commandDataSize,
+                           reinterpret_cast<std::uint8_t (&)[]>(response_buffer), response_buffer_size, timeoutInMs);
+    EmwOsInterface::Lock();
+    EmwCoreIpc::PostStatistics.posted++;
+    if (EmwCoreIpc::eSUCCESS == status) {
+      EmwCoreIpc::PostStatistics.answered++;
+      if (expectedStatus != response_buffer.status) {
+        EmwCoreIpc::PostStatistics.failed++;
+      }
+      if (nullptr != resultPtr) {
+        EmwCoreIpc::UpdatePostResult(*resultPtr, response_buffer.status, expectedStatus);
+      }
+    }
+    else {
+      EmwCoreIpc::PostStatistics.lost++;
+    }
+    EmwOsInterface::UnLock();
+#endif /* EMW_IPC_POST_WINDOW_SIZE */
+  }
+  DEBUG_IPC_LOG("  EmwCoreIpc::post()< %" PRIi32 "\n\n", static_cast<std::int32_t>(status))
+  return status;
+}
+
+void EmwCoreIpc::waitPosted(EmwCoreIpc::PostResult_t &result, std::uint32_t timeoutInMs) noexcept
+{
+#if (EMW_IPC_POST_WINDOW_SIZE > 0)
+  const std::uint32_t tstart = HAL_GetTick();
+  bool is_pending = EmwCoreIpc::IsPostPending(result);
+
+  while (is_pending && ((HAL_GetTick() - tstart) < timeoutInMs)) {
+#if defined(EMW_WITH_NO_OS)
+    this->poll(nullptr, 0U);
+#else
+    EmwOsInterface::DelayTicks(1U);
+#endif /* EMW_WITH_NO_OS */
+    (void) EmwCoreIpc::ReclaimPostedRequests();
+    is_pending = EmwCoreIpc::IsPostPending(result);
+  }
+  /* The posts still waiting are detached, their late responses must not reach the result. */
+  EmwOsInterface::Lock();
+  for (EmwCoreIpc::PostedRequest_t &posted : EmwCoreIpc::PostedRequests) {
+    if (&result == posted.resultPtr) {
+      posted.resultPtr = nullptr;
+    }
+  }
+  if (0U != result.pending) {
+    result.pending = 0U;
+    result.isFailed = true;
+  }
+  EmwOsInterface::UnLock();
+#else
+  static_cast<void>(result);
+  static_cast<void>(timeoutInMs);
+#endif /* EMW_IPC_POST_WINDOW_SIZE */
+}
+
 EmwCoreIpc::Status EmwCoreIpc::request(std::uint8_t (&commandData)[], std::uint16_t commandDataSize,
                                        std::uint8_t (&responseBuffer)[], std::uint16_t &responseBufferSize,
                                        std::uint32_t timeoutInMs) noexcept
@@ -158,6 +347,8 @@ EmwCoreIpc::Status EmwCoreIpc::request(std::uint8_t (&commandData)[], std::uint1
       EmwCoreIpc::PendingRequest.reqId = req_id;
       EmwCoreIpc::PendingRequest.responsePtr = responseBuffer;
       EmwCoreIpc::PendingRequest.responseSizePtr = &responseBufferSize;
+      /* The requester is woken up by the response, a late response to a previous request is dropped. */
+      EmwOsInterface::ArmNotification(EmwCoreIpc::PendingRequest.notification);
 
       if (EmwCoreIpc::IsPowerSaveEnabled) {
         (void) EmwCoreHci::Send(reinterpret_cast<const std::uint8_t *>("dummy"), 5U);
@@ -166,14 +357,13 @@ EmwCoreIpc::Status EmwCoreIpc::request(std::uint8_t (&commandData)[], std::uint1
       DEBUG_IPC_LOG("  EmwCoreIpc::request(): req_id: 0x%08" PRIx32 ", api_id: 0x%08" PRIx32 "\n",
                     req_id, static_cast<std::uint32_t>(api_id))
 
-      {
-        const std::int32_t hci_status = EmwCoreHci::Send(commandData, commandDataSize);
-        if (0 != hci_status) {
-          DRIVER_ERROR_VERBOSE("IPC failed to send command to HCI\n")
-        }
-        EmwOsInterface::AssertAlways(0 == hci_status);
+      if (0 != this->sendCommand(commandData, commandDataSize, timeoutInMs)) {
+        DRIVER_ERROR_VERBOSE("IPC failed to send command to HCI\n")
+        EmwCoreIpc::PendingRequest.reqId = REQ_ID_RESET_VAL;
+        status = EmwCoreIpc::eERROR;
       }
-      if (EmwOsInterface::eOK != EmwOsInterface::TakeSemaphore(EmwCoreIpc::PendingRequest.sem, timeoutInMs)) {
+      else if (EmwOsInterface::eOK \
+               != EmwOsInterface::WaitNotification(EmwCoreIpc::PendingRequest.notification, timeoutInMs)) {
         DEBUG_IPC_LOG("  EmwCoreIpc::request(): Error: command 0x%04" PRIx32 " timeout(%" PRIu32 " ms)" \
                       " waiting answer %" PRIu32 "\n",
                       static_cast<std::uint32_t>(api_id), timeoutInMs, EmwCoreIpc::PendingRequest.reqId)
@@ -230,6 +420,40 @@ EmwCoreIpc::Status EmwCoreIpc::testIpcEcho(std::uint8_t (&dataIn)[], std::uint16
   return status;
 }
 
+/* The echo is posted without waiting its response. The payload starts with its own length, an echo reads it
+ * back as its status, so that only a real echo of the packet matches, it is checked by testIpcPostCheck().
+ */
+EmwCoreIpc::Status EmwCoreIpc::testIpcPost(std::uint8_t (&dataIn)[], std::uint16_t dataInLength,
+    std::uint32_t timeoutInMs) noexcept
+{
+  EmwCoreIpc::Status status = EmwCoreIpc::eERROR;
+
+  if (((EmwCoreIpc::PACKET_MIN_SIZE + sizeof(EmwCoreIpc::SysCommonResponseParams_t)) <= dataInLength) \
+      && ((dataInLength - EmwCoreIpc::HEADER_SIZE) <= EmwNetworkStack::NETWORK_IPC_PAYLOAD_SIZE)) {
+    const std::int32_t stamp = static_cast<std::int32_t>(dataInLength);
+
+    SetApiId(dataIn, EmwCoreIpc::eSYS_ECHO_CMD);
+    (void) std::memcpy(SkipHeader(dataIn), &stamp, sizeof(stamp));
+    status = this->post(dataIn, dataInLength, timeoutInMs, &this->testPostResult, stamp);
+  }
+  return status;
+}
+
+/* Waits for the echoes posted by testIpcPost(), the length echoed is counted up to the first missing or bad one. */
+EmwCoreIpc::Status EmwCoreIpc::testIpcPostCheck(std::uint32_t &echoedLength, std::uint32_t timeoutInMs) noexcept
+{
+  EmwCoreIpc::Status status = EmwCoreIpc::eSUCCESS;
+
+  this->waitPosted(this->testPostResult, timeoutInMs);
+  echoedLength = static_cast<std::uint32_t>(this->testPostResult.total);
+  if (this->testPostResult.isFailed) {
+    status = EmwCoreIpc::eERROR;
+  }
+  this->testPostResult.total = 0;
+  this->testPostResult.isFailed = false;
+  return status;
+}
+
 void EmwCoreIpc::unInitialize(void) noexcept
 {
   DEBUG_IPC_LOG("  EmwCoreIpc::unInitialize()>\n")
@@ -237,14 +461,47 @@ void EmwCoreIpc::unInitialize(void) noexcept
   this->isUsable = false;
   {
     EmwScopedLock lock(EmwCoreIpc::IpcLock);
-    EmwOsInterface::DeleteSemaphore(EmwCoreIpc::PendingRequest.sem);
+    EmwOsInterface::DeleteNotification(EmwCoreIpc::PendingRequest.notification);
+#if (EMW_IPC_POST_WINDOW_SIZE > 0)
+    EmwOsInterface::DeleteSemaphore(EmwCoreIpc::PostWindowSem);
+#endif /* EMW_IPC_POST_WINDOW_SIZE */
   }
   EmwOsInterface::DeleteMutex(EmwCoreIpc::IpcLock);
   EmwCoreHci::UnInitialize();
+#if (EMW_IPC_POST_WINDOW_SIZE > 0)
+  /* The IO is stopped, none of the buffers of the window can still be in transfer. */
+  for (EmwCoreIpc::PostedRequest_t &posted : EmwCoreIpc::PostedRequests) {
+    EmwOsInterface::Free(posted.bufferPtr);
+    posted.bufferPtr = nullptr;
+    posted.resultPtr = nullptr;
+    posted.reqId = REQ_ID_RESET_VAL;
+  }
+#endif /* EMW_IPC_POST_WINDOW_SIZE */
 
   DEBUG_IPC_LOG("  EmwCoreIpc::unInitialize()<\n")
 }
 
+/* The frame of a posted command may still wait for its transfer, without RTOS nobody else moves it. */
+std::int32_t EmwCoreIpc::sendCommand(const std::uint8_t *commandDataPtr, std::uint16_t commandDataSize,
+                                     std::uint32_t timeoutInMs) noexcept
+{
+  std::int32_t hci_status = EmwCoreHci::Send(commandDataPtr, commandDataSize);
+
+#if defined(EMW_WITH_NO_OS)
+  {
+    const std::uint32_t tstart = HAL_GetTick();
+
+    while ((0 != hci_status) && ((HAL_GetTick() - tstart) < timeoutInMs)) {
+      this->poll(nullptr, 0U);
+      hci_status = EmwCoreHci::Send(commandDataPtr, commandDataSize);
+    }
+  }
+#else
+  static_cast<void>(timeoutInMs);
+#endif /* EMW_WITH_NO_OS */
+  return hci_status;
+}
+
 void EmwCoreIpc::poll(const void *argumentPtr, std::uint32_t timeoutInMs) noexcept
 {
   EmwNetworkStack::Buffer_t *const network_buffer_ptr = EmwCoreHci::Receive(timeoutInMs);
@@ -305,14 +562,14 @@ void EmwCoreIpc::processResponse(EmwNetworkStack::Buffer_t *networkBufferPtr, st
       const std::uint32_t buffer_size = payloadSize - EmwCoreIpc::PACKET_MIN_SIZE;
       const std::uint32_t actual_size = (response_buffer_size < buffer_size) ? response_buffer_size : buffer_size;
 
-      (void) std::memcpy(EmwCoreIpc::PendingRequest.responsePtr,
-                         static_cast<void *>(SkipHeader(payloadPtr)), actual_size);
+      (void) EMW_MEMCPY(EmwCoreIpc::PendingRequest.responsePtr,
+                        static_cast<void *>(SkipHeader(payloadPtr)), actual_size);
       *EmwCoreIpc::PendingRequest.responseSizePtr = static_cast<std::uint16_t>(actual_size);
     }
     EmwCoreIpc::PendingRequest.reqId = REQ_ID_RESET_VAL;
     {
       const EmwOsInterface::Status \
-      os_status = EmwOsInterface::ReleaseSemaphore(EmwCoreIpc::PendingRequest.sem);
+      os_status = EmwOsInterface::Notify(EmwCoreIpc::PendingRequest.notification);
 
       if (EmwOsInterface::eOK != os_status) {
         DRIVER_ERROR_VERBOSE("IPC failed to signal command response\n")
@@ -321,6 +578,11 @@ void EmwCoreIpc::processResponse(EmwNetworkStack::Buffer_t *networkBufferPtr, st
     }
     EMW_STATS_INCREMENT(cmdGetAnswer)
   }
+#if (EMW_IPC_POST_WINDOW_SIZE > 0)
+  else if (this->processPostedResponse(reqId, payloadPtr, payloadSize)) {
+    EMW_STATS_INCREMENT(cmdGetAnswer)
+  }
+#endif /* EMW_IPC_POST_WINDOW_SIZE */
   else {
     DEBUG_IPC_LOG("   EmwCoreIpc::poll(): response req_id: 0x%08" PRIx32
                   " not match pending reqId: 0x%08" PRIx32 "!\n",
@@ -329,7 +591,123 @@ void EmwCoreIpc::processResponse(EmwNetworkStack::Buffer_t *networkBufferPtr, st
   EmwCoreHci::Free(networkBufferPtr);
 }
 
+bool EmwCoreIpc::IsPostFailed(const EmwCoreIpc::PostResult_t &result) noexcept
+{
+  EmwOsInterface::Lock();
+  const bool is_failed = result.isFailed;
+  EmwOsInterface::UnLock();
+  return is_failed;
+}
+
+bool EmwCoreIpc::IsPostPending(const EmwCoreIpc::PostResult_t &result) noexcept
+{
+  EmwOsInterface::Lock();
+  const bool is_pending = (0U != result.pending);
+  EmwOsInterface::UnLock();
+  return is_pending;
+}
+
+/* Called with the OS lock taken. */
+void EmwCoreIpc::UpdatePostResult(EmwCoreIpc::PostResult_t &result, std::int32_t status,
+                                  std::int32_t expectedStatus) noexcept
+{
+  if (!result.isFailed) {
+    if (0 < status) {
+      result.total += status;
+    }
+    if (expectedStatus != status) {
+      result.isFailed = true;
+    }
+  }
+}
+
+#if (EMW_IPC_POST_WINDOW_SIZE > 0)
+bool EmwCoreIpc::processPostedResponse(std::uint32_t reqId, std::uint8_t *payloadPtr,
+                                       std::uint32_t payloadSize) noexcept
+{
+  bool is_posted = false;
+
+  EmwOsInterface::Lock();
+  for (EmwCoreIpc::PostedRequest_t &posted : EmwCoreIpc::PostedRequests) {
+    if (reqId == posted.reqId) {
+      EmwCoreIpc::SysCommonResponseParams_t response;
+      /* A response too short to carry a status fails its post. */
+      const bool is_status = ((EmwCoreIpc::PACKET_MIN_SIZE + sizeof(response)) <= payloadSize);
+
+      if (is_status) {
+        (void) std::memcpy(&response, SkipHeader(payloadPtr), sizeof(response));
+      }
+      if ((!is_status) || (posted.expectedStatus != response.status)) {
+        EmwCoreIpc::PostStatistics.failed++;
+      }
+      if (nullptr != posted.resultPtr) {
+        if (is_status) {
+          EmwCoreIpc::UpdatePostResult(*posted.resultPtr, response.status, posted.expectedStatus);
+        }
+        else {
+          posted.resultPtr->isFailed = true;
+        }
+        posted.resultPtr->pending--;
+        posted.resultPtr = nullptr;
+      }
+      EmwCoreIpc::PostStatistics.answered++;
+      posted.reqId = REQ_ID_RESET_VAL;
+      is_posted = true;
+      break;
+    }
+  }
+  EmwOsInterface::UnLock();
+  if (is_posted) {
+    (void) EmwOsInterface::ReleaseSemaphore(EmwCoreIpc::PostWindowSem);
+  }
+  return is_posted;
+}
+
+std::uint32_t EmwCoreIpc::ReclaimPostedRequests(void) noexcept
+{
+  std::uint32_t reclaimed_count = 0U;
+  std::uint32_t time_left_in_ms = EMW_OS_TIMEOUT_FOREVER;
+
+  EmwOsInterface::Lock();
+  for (EmwCoreIpc::PostedRequest_t &posted : EmwCoreIpc::PostedRequests) {
+    if (REQ_ID_RESET_VAL != posted.reqId) {
+      const std::uint32_t age_in_ms = HAL_GetTick() - posted.postTimeInMs;
+
+      if (age_in_ms >= posted.timeoutInMs) {
+        if (EmwCoreHci::IsSending(posted.bufferPtr)) {
+          /* Its frame is not transferred yet (the module holds the flow), the buffer stays in use. */
+          time_left_in_ms = 1U;
+        }
+        else {
+          if (nullptr != posted.resultPtr) {
+            posted.resultPtr->isFailed = true;
+            posted.resultPtr->pending--;
+            posted.resultPtr = nullptr;
+          }
+          posted.reqId = REQ_ID_RESET_VAL;
+          EmwCoreIpc::PostStatistics.lost++;
+          reclaimed_count++;
+        }
+      }
+      else if ((posted.timeoutInMs - age_in_ms) < time_left_in_ms) {
+        time_left_in_ms = posted.timeoutInMs - age_in_ms;
+      }
+    }
+  }
+  EmwOsInterface::UnLock();
+  for (; 0U < reclaimed_count; reclaimed_count--) {
+    (void) EmwOsInterface::ReleaseSemaphore(EmwCoreIpc::PostWindowSem);
+  }
+  return time_left_in_ms;
+}
+#endif /* EMW_IPC_POST_WINDOW_SIZE */
+
 
 EmwOsInterface::Mutex_t EmwCoreIpc::IpcLock;
 bool EmwCoreIpc::IsPowerSaveEnabled = false;
 EmwCoreIpc::HciResponse_t EmwCoreIpc::PendingRequest;
+#if (EMW_IPC_POST_WINDOW_SIZE > 0)
+EmwCoreIpc::PostedRequest_t EmwCoreIpc::PostedRequests[EMW_IPC_POST_WINDOW_SIZE];
+EmwOsInterface::Semaphore_t EmwCoreIpc::PostWindowSem;
+#endif /* EMW_IPC_POST_WINDOW_SIZE */
+EmwCoreIpc::PostStatistics_t EmwCoreIpc::PostStatistics;
@@ -18,6 +18,7 @@
   */
 #pragma once
 
+#include "emw_conf.hpp"
 #include "EmwApiBase.hpp"
 #include "EmwOsInterface.hpp"
 #include "EmwNetworkStack.hpp"
@@ -115,9 +116,51 @@ class EmwCoreIpc {
       eTLS_CLOSE_CMD,
       eTLS_SET_NONBLOCK_CMD
     };
+  public:
+    typedef struct PostStatistics_s {
+      constexpr PostStatistics_s(void) noexcept
+        : posted(0U), answered(0U), failed(0U), lost(0U), windowFull(0U) {}
+      std::uint32_t posted;
+      std::uint32_t answered;
+      std::uint32_t failed;
+      std::uint32_t lost;
+      std::uint32_t windowFull;
+    } PostStatistics_t;
+
+  protected:
+    /* Outcome of a set of posted commands, the responses come in the order of the commands.
+     * It is updated by the IPC under the OS lock, the owner reads it with IsPostFailed() while posting.
+     */
+    typedef struct PostResult_s {
+      constexpr PostResult_s(void) noexcept
+        : total(0), pending(0U), isFailed(false) {}
+      std::int32_t total;
+      std::uint32_t pending;
+      bool isFailed;
+    } PostResult_t;
+
   protected:
     void initialize(void) noexcept;
 
+  protected:
+    static void GetPostStatistics(EmwCoreIpc::PostStatistics_t &statistics) noexcept;
+  protected:
+    /* Sends a command without waiting for its response, the status of the response is only counted.
+     * The command is copied, at most EMW_IPC_POST_WINDOW_SIZE of them are waiting for their response,
+     * each one is given up when its response does not come within its own time out.
+     * With a result, a status of the response other than the expected one fails the result, the positive
+     * statuses received before are summed.
+     */
+    Status post(std::uint8_t (&commandData)[], std::uint16_t commandDataSize, std::uint32_t timeoutInMs,
+                EmwCoreIpc::PostResult_t *resultPtr = nullptr, std::int32_t expectedStatus = 0) noexcept;
+  protected:
+    /* Waits for the responses of the commands posted with this result, the result must outlive its posts. */
+    void waitPosted(EmwCoreIpc::PostResult_t &result, std::uint32_t timeoutInMs) noexcept;
+  protected:
+    static bool IsPostFailed(const EmwCoreIpc::PostResult_t &result) noexcept;
+  private:
+    std::int32_t sendCommand(const std::uint8_t *commandDataPtr, std::uint16_t commandDataSize,
+                             std::uint32_t timeoutInMs) noexcept;
   protected:
     Status request(std::uint8_t (&commandData)[], std::uint16_t commandDataSize,
                    std::uint8_t (&responseBuffer)[], std::uint16_t &responseBufferSize,
@@ -128,6 +171,10 @@ class EmwCoreIpc {
     Status testIpcEcho(std::uint8_t (&dataIn)[], std::uint16_t dataInLength,
                        std::uint8_t (&dataOut)[], std::uint16_t &dataOutLength,
                        std::uint32_t timeoutInMs) noexcept;
+  protected:
+    Status testIpcPost(std::uint8_t (&dataIn)[], std::uint16_t dataInLength, std::uint32_t timeoutInMs) noexcept;
+  protected:
+    Status testIpcPostCheck(std::uint32_t &echoedLength, std::uint32_t timeoutInMs) noexcept;
   protected:
     void unInitialize(void) noexcept;
 
@@ -609,6 +656,8 @@ class EmwCoreIpc {
 
     typedef __PACKED_STRUCT SocketReceivefromParams_s {
       constexpr SocketReceivefromParams_s(void) noexcept : socket(-1), size(0), flags(0) {}
+      constexpr SocketReceivefromParams_s(std::int32_t socket, std::size_t size, std::int32_t flags) noexcept
+        : socket(socket), size(size), flags(flags) {}
       std::int32_t socket;
       std::size_t size;
       std::int32_t flags;
@@ -616,6 +665,8 @@ class EmwCoreIpc {
 
     typedef __PACKED_STRUCT IpcSocketReceiveFromParams_s {
       constexpr IpcSocketReceiveFromParams_s(void) noexcept : ipcParams(EmwCoreIpc::eSOCKET_RECVFROM_CMD), receiveFromParams() {}
+      constexpr explicit IpcSocketReceiveFromParams_s(std::int32_t socket, std::size_t size, std::int32_t flags) noexcept
+        : ipcParams(EmwCoreIpc::eSOCKET_RECVFROM_CMD), receiveFromParams(socket, size, flags) {}
       CmdParams_t ipcParams;
       SocketReceivefromParams_t receiveFromParams;
     } IpcSocketReceiveFromParams_t;
@@ -700,35 +751,72 @@ class EmwCoreIpc {
       EmwAddress::SockLen_t nameLength;
     } SocketGetSockNameResponseParams_t;
 
-    typedef __PACKED_STRUCT {
+    typedef __PACKED_STRUCT SocketListenParams_s {
+      constexpr SocketListenParams_s(void) noexcept : socket(-1), backlog(0) {}
+      constexpr explicit SocketListenParams_s(std::int32_t socket, std::int32_t backlog) noexcept
+        : socket(socket), backlog(backlog) {}
       std::int32_t socket;
       std::int32_t backlog;
     } SocketListenParams_t;
 
-    typedef __PACKED_STRUCT {
+    typedef __PACKED_STRUCT IpcSocketListenParams_s {
+      constexpr IpcSocketListenParams_s(void) noexcept : ipcParams(EmwCoreIpc::eSOCKET_LISTEN_CMD), listenParams() {}
+      constexpr explicit IpcSocketListenParams_s(std::int32_t socket, std::int32_t backlog) noexcept
+        : ipcParams(EmwCoreIpc::eSOCKET_LISTEN_CMD), listenParams(socket, backlog) {}
       CmdParams_t ipcParams;
       SocketListenParams_t listenParams;
     } IpcSocketListenParams_t;
 
-    typedef __PACKED_STRUCT {
+    typedef __PACKED_STRUCT SocketListenResponseParams_s {
+      constexpr SocketListenResponseParams_s(void) noexcept : status(-1) {}
       std::int32_t status;
     } SocketListenResponseParams_t;
 
-    typedef __PACKED_STRUCT {
+    typedef __PACKED_STRUCT SocketAcceptParams_s {
+      constexpr SocketAcceptParams_s(void) noexcept : socket(-1) {}
+      constexpr explicit SocketAcceptParams_s(std::int32_t socket) noexcept : socket(socket) {}
       std::int32_t socket;
     } SocketAcceptParams_t;
 
-    typedef __PACKED_STRUCT {
+    typedef __PACKED_STRUCT IpcSocketAcceptParams_s {
+      constexpr IpcSocketAcceptParams_s(void) noexcept : ipcParams(EmwCoreIpc::eSOCKET_ACCEPT_CMD), acceptParams() {}
+      constexpr explicit IpcSocketAcceptParams_s(std::int32_t socket) noexcept
+        : ipcParams(EmwCoreIpc::eSOCKET_ACCEPT_CMD), acceptParams(socket) {}
       CmdParams_t ipcParams;
       SocketAcceptParams_t acceptParams;
     } IpcSocketAcceptParams_t;
 
-    typedef __PACKED_STRUCT {
+    typedef __PACKED_STRUCT SocketAcceptResponseParams_s {
+      constexpr SocketAcceptResponseParams_s(void) noexcept : socket(-1), addr(), length(0U) {}
       std::int32_t socket;
       EmwAddress::SockAddrStorage_t addr;
       EmwAddress::SockLen_t length;
     } SocketAcceptResponseParams_t;
 
+    typedef __PACKED_STRUCT SocketSelectParams_s {
+      constexpr SocketSelectParams_s(void) noexcept
+        : nfds(0), readFds(), writeFds(), exceptFds(), timeout() {}
+      std::int32_t nfds;
+      EmwFdSet_t readFds;
+      EmwFdSet_t writeFds;
+      EmwFdSet_t exceptFds;
+      EmwTimeVal_t timeout;
+    } SocketSelectParams_t;
+
+    typedef __PACKED_STRUCT IpcSocketSelectParams_s {
+      constexpr IpcSocketSelectParams_s(void) noexcept : ipcParams(EmwCoreIpc::eSOCKET_SELECT_CMD), selectParams() {}
+      CmdParams_t ipcParams;
+      SocketSelectParams_t selectParams;
+    } IpcSocketSelectParams_t;
+
+    typedef __PACKED_STRUCT SocketSelectResponseParams_s {
+      constexpr SocketSelectResponseParams_s(void) noexcept : status(-1), readFds(), writeFds(), exceptFds() {}
+      std::int32_t status;
+      EmwFdSet_t readFds;
+      EmwFdSet_t writeFds;
+      EmwFdSet_t exceptFds;
+    } SocketSelectResponseParams_t;
+
     typedef __PACKED_STRUCT TlsSetVersionParams_s {
       constexpr TlsSetVersionParams_s(void) noexcept
         : version(0U) {}
@@ -923,8 +1011,14 @@ class EmwCoreIpc {
   private:
     void processResponse(EmwNetworkStack::Buffer_t *networkBufferPtr, std::uint32_t reqId,
                          std::uint8_t *payloadPtr, std::uint32_t payloadSize) noexcept;
+#if (EMW_IPC_POST_WINDOW_SIZE > 0)
+  private:
+    bool processPostedResponse(std::uint32_t reqId, std::uint8_t *payloadPtr, std::uint32_t payloadSize) noexcept;
+#endif /* EMW_IPC_POST_WINDOW_SIZE */
   private:
     bool isUsable;
+  private:
+    EmwCoreIpc::PostResult_t testPostResult;
 
   private:
     static EmwOsInterface::Mutex_t IpcLock;
@@ -933,12 +1027,39 @@ class EmwCoreIpc {
   private:
     typedef struct {
       volatile /*_Atomic*/ std::uint32_t reqId;
-      EmwOsInterface::Semaphore_t sem;
+      EmwOsInterface::Notification_t notification;
       std::uint16_t *responseSizePtr;
       std::uint8_t *responsePtr;
     } HciResponse_t;
   private:
     static HciResponse_t PendingRequest;
+#if (EMW_IPC_POST_WINDOW_SIZE > 0)
+  private:
+    typedef struct {
+      volatile /*_Atomic*/ std::uint32_t reqId;
+      std::uint32_t postTimeInMs;
+      std::uint32_t timeoutInMs;
+      std::uint8_t *bufferPtr;
+      EmwCoreIpc::PostResult_t *resultPtr;
+      std::int32_t expectedStatus;
+    } PostedRequest_t;
+  private:
+    /* Gives up each posted request older than its own time out, returns the time left to the next one.
+     * A request whose frame still waits for its transfer is kept, its buffer cannot be reused.
+     */
+    static std::uint32_t ReclaimPostedRequests(void) noexcept;
+  private:
+    static PostedRequest_t PostedRequests[EMW_IPC_POST_WINDOW_SIZE];
+  private:
+    static EmwOsInterface::Semaphore_t PostWindowSem;
+#endif /* EMW_IPC_POST_WINDOW_SIZE */
+  private:
+    static bool IsPostPending(const EmwCoreIpc::PostResult_t &result) noexcept;
+  private:
+    static void UpdatePostResult(EmwCoreIpc::PostResult_t &result, std::int32_t status,
+                                 std::int32_t expectedStatus) noexcept;
+  private:
+    static PostStatistics_t PostStatistics;
   private:
     static const std::uint16_t HEADER_SIZE = 6U;
   private:
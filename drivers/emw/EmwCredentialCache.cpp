@@ -0,0 +1,119 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "emw_conf.hpp"
+#include "EmwCredentialCache.hpp"
+#include "EmwOsInterface.hpp"
+#include <cinttypes>
+#include <cstdint>
+
+#if !defined(EMW_API_DEBUG)
+#define DEBUG_API_LOG(...)
+#endif /* EMW_API_DEBUG */
+
+
+EmwCredentialCache::EmwCredentialCache(void) noexcept
+  : entries()
+  , statistics()
+{
+}
+
+void EmwCredentialCache::getStatistics(EmwCredentialCache::Statistics_t &statistics) const noexcept
+{
+  EmwOsInterface::Lock();
+  statistics = this->statistics;
+  EmwOsInterface::UnLock();
+}
+
+void EmwCredentialCache::invalidate(void) noexcept
+{
+  EmwOsInterface::Lock();
+  for (EmwCredentialCache::Entry_t &entry : this->entries) {
+    entry.isValid = false;
+  }
+  this->statistics.invalidations++;
+  EmwOsInterface::UnLock();
+  DEBUG_API_LOG(" EmwCredentialCache::invalidate()\n")
+}
+
+void EmwCredentialCache::invalidate(EmwCredentialCache::Slot slot) noexcept
+{
+  if (EmwCredentialCache::eSLOT_COUNT > slot) {
+    EmwOsInterface::Lock();
+    this->entries[slot].isValid = false;
+    EmwOsInterface::UnLock();
+  }
+}
+
+bool EmwCredentialCache::isUploaded(EmwCredentialCache::Slot slot, const std::uint8_t *dataPtr,
+                                    std::size_t length) noexcept
+{
+  bool is_uploaded = false;
+
+  if (EmwCredentialCache::eSLOT_COUNT > slot) {
+    const std::uint64_t hash = EmwCredentialCache::Hash(dataPtr, length);
+
+    EmwOsInterface::Lock();
+    {
+      const EmwCredentialCache::Entry_t &entry = this->entries[slot];
+
+      if (entry.isValid && (length == entry.length) && (hash == entry.hash)) {
+        this->statistics.skips++;
+        this->statistics.skippedBytes += static_cast<std::uint32_t>(length);
+        this->statistics.savedTimeInMs += entry.uploadTimeInMs;
+        is_uploaded = true;
+      }
+    }
+    EmwOsInterface::UnLock();
+  }
+  DEBUG_API_LOG(" EmwCredentialCache::isUploaded(): slot %" PRIu32 " %" PRIi32 "\n",
+                static_cast<std::uint32_t>(slot), static_cast<std::int32_t>(is_uploaded))
+  return is_uploaded;
+}
+
+void EmwCredentialCache::setUploaded(EmwCredentialCache::Slot slot, const std::uint8_t *dataPtr, std::size_t length,
+                                     std::uint32_t uploadTimeInMs) noexcept
+{
+  if (EmwCredentialCache::eSLOT_COUNT > slot) {
+    const std::uint64_t hash = EmwCredentialCache::Hash(dataPtr, length);
+
+    EmwOsInterface::Lock();
+    {
+      EmwCredentialCache::Entry_t &entry = this->entries[slot];
+
+      entry.isValid = true;
+      entry.length = length;
+      entry.hash = hash;
+      entry.uploadTimeInMs = uploadTimeInMs;
+      this->statistics.uploads++;
+    }
+    EmwOsInterface::UnLock();
+  }
+}
+
+/* FNV-1a on 64 bits, enough to detect a changed credential. */
+std::uint64_t EmwCredentialCache::Hash(const std::uint8_t *dataPtr, std::size_t length) noexcept
+{
+  std::uint64_t hash = 0xCBF29CE484222325ULL;
+
+  for (std::size_t i = 0U; i < length; i++) {
+    hash ^= static_cast<std::uint64_t>(dataPtr[i]);
+    hash *= 0x00000100000001B3ULL;
+  }
+  return hash;
+}
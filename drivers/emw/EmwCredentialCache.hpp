@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "emw_conf.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/* Remembers the credentials already uploaded to the EMW module, one slot per credential kind.
+ * Only a hash and the length of each credential are kept, the module keeps them up to its next reboot.
+ */
+class EmwCredentialCache final {
+  public:
+    enum /*class*/ Slot : std::uint8_t {
+      eTLS_CLIENT_CERTIFICATE = 0,
+      eTLS_CLIENT_PRIVATE_KEY = 1,
+      eEAP_ROOT_CA = 2,
+      eEAP_CLIENT_CERTIFICATE = 3,
+      eEAP_CLIENT_KEY = 4,
+      eSLOT_COUNT = 5
+    };
+
+  public:
+    typedef struct Statistics_s {
+      constexpr Statistics_s(void) noexcept
+        : uploads(0U), skips(0U), skippedBytes(0U), savedTimeInMs(0U), invalidations(0U) {}
+      std::uint32_t uploads;
+      std::uint32_t skips;
+      std::uint32_t skippedBytes;
+      std::uint32_t savedTimeInMs;
+      std::uint32_t invalidations;
+    } Statistics_t;
+
+  public:
+    EmwCredentialCache(void) noexcept;
+  public:
+    void getStatistics(EmwCredentialCache::Statistics_t &statistics) const noexcept;
+  public:
+    /* Forgets all the slots, to be called when the module has rebooted. */
+    void invalidate(void) noexcept;
+  public:
+    void invalidate(EmwCredentialCache::Slot slot) noexcept;
+  public:
+    /* Returns true when the same credential is already in the module, the upload can be skipped. */
+    bool isUploaded(EmwCredentialCache::Slot slot, const std::uint8_t *dataPtr, std::size_t length) noexcept;
+  public:
+    void setUploaded(EmwCredentialCache::Slot slot, const std::uint8_t *dataPtr, std::size_t length,
+                     std::uint32_t uploadTimeInMs) noexcept;
+
+  private:
+    typedef struct Entry_s {
+      constexpr Entry_s(void) noexcept
+        : isValid(false), length(0U), hash(0U), uploadTimeInMs(0U) {}
+      bool isValid;
+      std::size_t length;
+      std::uint64_t hash;
+      std::uint32_t uploadTimeInMs;
+    } Entry_t;
+
+  private:
+    static std::uint64_t Hash(const std::uint8_t *dataPtr, std::size_t length) noexcept;
+
+  private:
+    EmwCredentialCache::Entry_t entries[EmwCredentialCache::eSLOT_COUNT];
+  private:
+    EmwCredentialCache::Statistics_t statistics;
+};
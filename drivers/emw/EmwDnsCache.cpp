@@ -0,0 +1,142 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "emw_conf.hpp"
+#include "EmwDnsCache.hpp"
+#include "EmwOsInterface.hpp"
+#include "stm32u5xx_hal.h"
+#include <cinttypes>
+#include <cstring>
+
+#if !defined(EMW_API_DEBUG)
+#define DEBUG_API_LOG(...)
+#endif /* EMW_API_DEBUG */
+
+
+EmwDnsCache::EmwDnsCache(void) noexcept
+  : entries()
+  , statistics()
+  , useCounter(0U)
+{
+}
+
+void EmwDnsCache::flush(void) noexcept
+{
+  EmwOsInterface::Lock();
+  for (EmwDnsCache::Entry_t &entry : this->entries) {
+    entry.isUsed = false;
+  }
+  EmwOsInterface::UnLock();
+}
+
+void EmwDnsCache::getStatistics(EmwDnsCache::Statistics_t &statistics) const noexcept
+{
+  EmwOsInterface::Lock();
+  statistics = this->statistics;
+  EmwOsInterface::UnLock();
+}
+
+bool EmwDnsCache::lookUp(const char *nameStringPtr, EmwDnsCache::Query query, const EmwDnsCache::Answer_t &hints,
+                         EmwDnsCache::Answer_t &answer, bool &isNegative) noexcept
+{
+  bool found = false;
+
+  EmwOsInterface::Lock();
+  {
+    EmwDnsCache::Entry_t * const entry_ptr = this->find(nameStringPtr, query, hints);
+
+    if (nullptr == entry_ptr) {
+      this->statistics.misses++;
+    }
+    else if ((HAL_GetTick() - entry_ptr->storeTimeInMs) >= entry_ptr->lifeTimeInMs) {
+      entry_ptr->isUsed = false;
+      this->statistics.expirations++;
+      this->statistics.misses++;
+    }
+    else {
+      entry_ptr->lastUse = ++this->useCounter;
+      isNegative = entry_ptr->isNegative;
+      if (isNegative) {
+        this->statistics.negativeHits++;
+      }
+      else {
+        answer = entry_ptr->answer;
+        this->statistics.hits++;
+      }
+      found = true;
+    }
+  }
+  EmwOsInterface::UnLock();
+  DEBUG_API_LOG(" EmwDnsCache::lookUp(): \"%s\" %" PRIi32 "\n", nameStringPtr, static_cast<std::int32_t>(found))
+  return found;
+}
+
+void EmwDnsCache::store(const char *nameStringPtr, EmwDnsCache::Query query, const EmwDnsCache::Answer_t &hints,
+                        const EmwDnsCache::Answer_t *answerPtr) noexcept
+{
+  /* The names too long for an entry are never cached. */
+  if (std::strlen(nameStringPtr) < sizeof(this->entries[0].name)) {
+    EmwOsInterface::Lock();
+    {
+      EmwDnsCache::Entry_t *entry_ptr = this->find(nameStringPtr, query, hints);
+
+      /* Otherwise take a free entry, or the least recently used one. */
+      if (nullptr == entry_ptr) {
+        entry_ptr = &this->entries[0];
+        for (EmwDnsCache::Entry_t &entry : this->entries) {
+          if (!entry.isUsed) {
+            entry_ptr = &entry;
+            break;
+          }
+          if ((entry.lastUse - entry_ptr->lastUse) > (UINT32_MAX / 2U)) {
+            entry_ptr = &entry;
+          }
+        }
+        if (entry_ptr->isUsed) {
+          this->statistics.evictions++;
+        }
+        (void) std::strncpy(entry_ptr->name, nameStringPtr, sizeof(entry_ptr->name) - 1U);
+        entry_ptr->name[sizeof(entry_ptr->name) - 1U] = '\0';
+        entry_ptr->query = query;
+        entry_ptr->hints = hints;
+      }
+      entry_ptr->isUsed = true;
+      entry_ptr->isNegative = (nullptr == answerPtr);
+      entry_ptr->storeTimeInMs = HAL_GetTick();
+      entry_ptr->lifeTimeInMs = (nullptr == answerPtr) ? EMW_DNS_CACHE_NEGATIVE_TTL_MS : EMW_DNS_CACHE_TTL_MS;
+      entry_ptr->lastUse = ++this->useCounter;
+      if (nullptr != answerPtr) {
+        entry_ptr->answer = *answerPtr;
+      }
+    }
+    EmwOsInterface::UnLock();
+  }
+}
+
+EmwDnsCache::Entry_t *EmwDnsCache::find(const char *nameStringPtr, EmwDnsCache::Query query,
+                                        const EmwDnsCache::Answer_t &hints) noexcept
+{
+  for (EmwDnsCache::Entry_t &entry : this->entries) {
+    if (entry.isUsed && (query == entry.query) && (hints.family == entry.hints.family) \
+        && (hints.sockType == entry.hints.sockType) && (hints.protocol == entry.hints.protocol) \
+        && (0 == std::strncmp(nameStringPtr, entry.name, sizeof(entry.name)))) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
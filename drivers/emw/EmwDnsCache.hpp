@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "emw_conf.hpp"
+#include "EmwAddress.hpp"
+#include <cstdint>
+
+/* Small LRU cache of the host name resolutions done by the EMW module.
+ * The module does not report the TTL of the answers, a fixed life time is applied.
+ * The failed resolutions are also kept, for a shorter time.
+ * The cache is flushed when the module reboots or the station disconnects.
+ */
+class EmwDnsCache final {
+  public:
+    enum /*class*/ Query : std::uint8_t {
+      eHOST_BY_NAME = 0,
+      eADDR_INFO = 1
+    };
+
+  public:
+    typedef struct Answer_s {
+      constexpr Answer_s(void) noexcept
+        : flags(0), family(0), sockType(0), protocol(0), addrLen(0U), sAddr(), canonName{'\0'} {}
+      std::int32_t flags;
+      std::int32_t family;
+      std::int32_t sockType;
+      std::int32_t protocol;
+      EmwAddress::SockLen_t addrLen;
+      EmwAddress::SockAddrStorage_t sAddr;
+      char canonName[EMW_DNS_CACHE_NAME_SIZE];
+    } Answer_t;
+
+  public:
+    typedef struct Statistics_s {
+      constexpr Statistics_s(void) noexcept
+        : hits(0U), negativeHits(0U), misses(0U), expirations(0U), evictions(0U) {}
+      std::uint32_t hits;
+      std::uint32_t negativeHits;
+      std::uint32_t misses;
+      std::uint32_t expirations;
+      std::uint32_t evictions;
+    } Statistics_t;
+
+  public:
+    EmwDnsCache(void) noexcept;
+  public:
+    void flush(void) noexcept;
+  public:
+    void getStatistics(EmwDnsCache::Statistics_t &statistics) const noexcept;
+  public:
+    /* Returns true when an entry is found, isNegative tells if it is a failed resolution. */
+    bool lookUp(const char *nameStringPtr, EmwDnsCache::Query query, const EmwDnsCache::Answer_t &hints,
+                EmwDnsCache::Answer_t &answer, bool &isNegative) noexcept;
+  public:
+    /* A null answer pointer records a failed resolution. */
+    void store(const char *nameStringPtr, EmwDnsCache::Query query, const EmwDnsCache::Answer_t &hints,
+               const EmwDnsCache::Answer_t *answerPtr) noexcept;
+
+  private:
+    typedef struct Entry_s {
+      constexpr Entry_s(void) noexcept
+        : name{'\0'}, query(EmwDnsCache::eHOST_BY_NAME), isUsed(false), isNegative(false),
+          storeTimeInMs(0U), lifeTimeInMs(0U), lastUse(0U), hints(), answer() {}
+      char name[EMW_DNS_CACHE_NAME_SIZE];
+      EmwDnsCache::Query query;
+      bool isUsed;
+      bool isNegative;
+      std::uint32_t storeTimeInMs;
+      std::uint32_t lifeTimeInMs;
+      std::uint32_t lastUse;
+      EmwDnsCache::Answer_t hints;
+      EmwDnsCache::Answer_t answer;
+    } Entry_t;
+
+  private:
+    EmwDnsCache::Entry_t *find(const char *nameStringPtr, EmwDnsCache::Query query,
+                               const EmwDnsCache::Answer_t &hints) noexcept;
+
+  private:
+    EmwDnsCache::Entry_t entries[EMW_DNS_CACHE_ENTRY_COUNT];
+  private:
+    EmwDnsCache::Statistics_t statistics;
+  private:
+    std::uint32_t useCounter;
+};
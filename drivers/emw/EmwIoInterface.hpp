@@ -59,6 +59,12 @@ template <class EmwIo> class EmwIoInterface {
     {
       return static_cast<EmwIo *>(this)->sendImp(dataPtr, dataLength);
     }
+  public:
+    /* Tells whether the data given to send() is still waiting for its transfer, so it must not be reused yet. */
+    bool isSending(const std::uint8_t *dataPtr) const noexcept
+    {
+      return static_cast<const EmwIo *>(this)->isSendingImp(dataPtr);
+    }
   public:
     std::int8_t unInitialize(void) noexcept
     {
@@ -17,6 +17,7 @@
   ******************************************************************************
   */
 #include "EmwIoSpi.hpp"
+#include "CycleCounter.hpp"
 #include "EmwApiBase.hpp"
 #include "EmwApiCore.hpp"
 #include "EmwCoreHci.hpp"
@@ -86,26 +87,24 @@ void EmwIoSpi::pollDataImp(std::uint32_t timeoutInMs) noexcept
 
 void EmwIoSpi::processPollingDataImp(std::uint32_t timeoutInMs) noexcept
 {
-  static EmwNetworkStack::Buffer_t *network_buffer_ptr = nullptr;
-  bool first_miss = true;
-
   this->setChipSelectHigh();
 
-  while (nullptr == network_buffer_ptr) {
-    network_buffer_ptr = EmwNetworkStack::AllocBuffer();
-    if (nullptr == network_buffer_ptr) {
-#if defined(EMW_WITH_RTOS)
-      /* Be cooperative */
-      EmwOsInterface::DelayTicks(1U);
-#endif /* EMW_WITH_RTOS */
-      if (first_miss) {
-        first_miss = false;
-        DEBUG_IO_WARNING("Running out of buffer for RX\n")
+  if (EmwOsInterface::eOK == EmwOsInterface::WaitNotification(EmwIoSpi::TxRxNotification, timeoutInMs)) {
+    bool is_continue = true;
+
+    if (EmwIoSpi::IsNotifyStamped) {
+      const std::uint32_t cycles = CycleCounter::Get() - EmwIoSpi::NotifyCycles;
+
+      EmwIoSpi::IsNotifyStamped = false;
+      if (cycles < EmwIoSpi::WakeLatency.minCycles) {
+        EmwIoSpi::WakeLatency.minCycles = cycles;
       }
+      if (cycles > EmwIoSpi::WakeLatency.maxCycles) {
+        EmwIoSpi::WakeLatency.maxCycles = cycles;
+      }
+      EmwIoSpi::WakeLatency.sumCycles += cycles;
+      EmwIoSpi::WakeLatency.count++;
     }
-  }
-  if (EmwOsInterface::eOK == EmwOsInterface::TakeSemaphore(EmwIoSpi::TxRxSem, timeoutInMs)) {
-    bool is_continue = true;
 
     EmwScopedLock lock(EmwIoSpi::TxLock);
 
@@ -114,12 +113,6 @@ void EmwIoSpi::processPollingDataImp(std::uint32_t timeoutInMs) noexcept
     if (nullptr == EmwIoSpi::TxDataAddress) {
       if (!this->isNotifyHigh()) {
         is_continue = false;
-#if defined(EMW_WITH_RTOS)
-        if (EmwIoSpi::IoThreadQuitFlag) {
-          EmwNetworkStack::FreeBuffer(network_buffer_ptr);
-          network_buffer_ptr = nullptr;
-        }
-#endif /* EMW_WITH_RTOS */
       }
     }
     if (is_continue) {
@@ -130,13 +123,14 @@ void EmwIoSpi::processPollingDataImp(std::uint32_t timeoutInMs) noexcept
       else {
         std::uint16_t rx_length = 0U;
         if (0 == this->exchangeHeaders(EmwIoSpi::TxDataLength, rx_length)) {
-          if (EmwNetworkStack::GetBufferPayloadSize(network_buffer_ptr) < rx_length) {
+          if (EmwNetworkStack::NETWORK_BUFFER_SIZE < rx_length) {
             DEBUG_IO_LOG("EmwIoSpi::processPollingDataImp(): length: %" PRIu32 "-%" PRIu32 "\n",
                          static_cast<std::uint32_t>(rx_length), static_cast<std::uint32_t>(EmwIoSpi::TxDataLength))
             DRIVER_ERROR_VERBOSE("SPI length invalid\n")
           }
           else {
             std::uint16_t data_length;
+            EmwNetworkStack::Buffer_t *network_buffer_ptr = nullptr;
             std::uint8_t *rx_data_ptr = nullptr;
             if (EmwIoSpi::TxDataLength > rx_length) {
               data_length = EmwIoSpi::TxDataLength;
@@ -145,10 +139,18 @@ void EmwIoSpi::processPollingDataImp(std::uint32_t timeoutInMs) noexcept
               data_length = rx_length;
             }
             if (0U < rx_length) {
-              rx_data_ptr = EmwNetworkStack::GetBufferPayload(network_buffer_ptr);
+              /* The length is known now, a short frame does not take a full size buffer.
+               * The buffer also receives the dummy bytes of a longer transmit. */
+              network_buffer_ptr = this->allocReceiveBuffer(data_length);
+              if (nullptr != network_buffer_ptr) {
+                rx_data_ptr = EmwNetworkStack::GetBufferPayload(network_buffer_ptr);
+              }
             }
             if (0 != this->waitFlowHigh()) {
               DRIVER_ERROR_VERBOSE("Wait FLOW timeout 1\n")
+              if (nullptr != network_buffer_ptr) {
+                EmwNetworkStack::FreeBuffer(network_buffer_ptr);
+              }
             }
             else {
               HAL_StatusTypeDef ret;
@@ -162,21 +164,33 @@ void EmwIoSpi::processPollingDataImp(std::uint32_t timeoutInMs) noexcept
                 }
                 EmwIoSpi::TxDataAddress = nullptr;
                 EmwIoSpi::TxDataLength = 0U;
+                (void) EmwOsInterface::ReleaseSemaphore(EmwIoSpi::TxDoneSem);
               }
-              else {
+              else if (nullptr != rx_data_ptr) {
                 ret = this->receive(rx_data_ptr, data_length);
               }
+              else {
+                ret = this->discard(data_length);
+              }
               if (HAL_OK != ret) {
                 DRIVER_ERROR_VERBOSE("SPI Transmit / Receive data timeout\n")
+                if (nullptr != network_buffer_ptr) {
+                  EmwNetworkStack::FreeBuffer(network_buffer_ptr);
+                }
               }
               else {
                 DEBUG_IO_LOG("EmwIoSpi::processPollingDataImp(): slave header length: %" PRIu32 "\n",
                              static_cast<std::uint32_t>(rx_length))
 
-                if (0U < rx_length) {
+                if (nullptr != network_buffer_ptr) {
                   EmwNetworkStack::SetBufferPayloadSize(network_buffer_ptr, rx_length);
                   EmwCoreHci::Input(network_buffer_ptr);
-                  network_buffer_ptr = nullptr;
+                }
+                else if (0U < rx_length) {
+                  EMW_STATS_INCREMENT(rxDropped)
+                }
+                else {
+                  /* Transmit only. */
                 }
               }
             }
@@ -189,6 +203,46 @@ void EmwIoSpi::processPollingDataImp(std::uint32_t timeoutInMs) noexcept
   }
 }
 
+/* The chip select is low, so the number of attempts is bounded, the caller drops the payload on failure. */
+EmwNetworkStack::Buffer_t *EmwIoSpi::allocReceiveBuffer(std::uint16_t length) noexcept
+{
+  EmwNetworkStack::Buffer_t *network_buffer_ptr = EmwNetworkStack::AllocBuffer(length);
+
+  for (std::uint32_t attempt = 1U; (nullptr == network_buffer_ptr) && (EMW_IO_SPI_RX_ALLOC_ATTEMPT_COUNT > attempt);
+       attempt++) {
+#if defined(EMW_WITH_RTOS)
+    /* Be cooperative */
+    EmwOsInterface::DelayTicks(1U);
+#endif /* EMW_WITH_RTOS */
+    network_buffer_ptr = EmwNetworkStack::AllocBuffer(length);
+  }
+  if (nullptr == network_buffer_ptr) {
+    DEBUG_IO_WARNING("Running out of buffer for RX\n")
+  }
+  return network_buffer_ptr;
+}
+
+/* Clocks the payload into the scratch buffer, so that the transaction completes without a network buffer. */
+HAL_StatusTypeDef EmwIoSpi::discard(std::uint16_t rxDataLength) noexcept
+{
+  HAL_StatusTypeDef status = HAL_OK;
+  std::uint16_t remaining_length = rxDataLength;
+
+  while ((HAL_OK == status) && (0U < remaining_length)) {
+    const std::uint16_t chunk_length = (sizeof(EmwIoSpi::RxScratch) < remaining_length)
+                                       ? static_cast<std::uint16_t>(sizeof(EmwIoSpi::RxScratch)) : remaining_length;
+
+    status = this->receive(EmwIoSpi::RxScratch, chunk_length);
+    remaining_length -= chunk_length;
+  }
+  return status;
+}
+
+bool EmwIoSpi::isSendingImp(const std::uint8_t *dataPtr) const noexcept
+{
+  return (nullptr != dataPtr) && (dataPtr == EmwIoSpi::TxDataAddress);
+}
+
 std::uint16_t EmwIoSpi::sendImp(const std::uint8_t *dataPtr, std::uint16_t dataLength) noexcept
 {
   std::uint16_t sent;
@@ -201,14 +255,29 @@ std::uint16_t EmwIoSpi::sendImp(const std::uint8_t *dataPtr, std::uint16_t dataL
     sent = 0U;
   }
   else {
+#if defined(EMW_WITH_RTOS)
+    /* The data of a command posted without waiting its response may not be transferred yet. */
+    while (nullptr != EmwIoSpi::TxDataAddress) {
+      if (EmwOsInterface::eOK != EmwOsInterface::TakeSemaphore(EmwIoSpi::TxDoneSem, EmwIoSpi::TIMEOUT_HARDWARE_EMW_MS)) {
+        break;
+      }
+    }
+#endif /* EMW_WITH_RTOS */
     EmwScopedLock lock(EmwIoSpi::TxLock);
 
-    EmwIoSpi::TxDataAddress = dataPtr;
-    EmwIoSpi::TxDataLength = dataLength;
-    if (EmwOsInterface::eOK != EmwOsInterface::ReleaseSemaphore(EmwIoSpi::TxRxSem)) {
-      DRIVER_ERROR_VERBOSE("Warning, SPI semaphore has been already notified\n")
+    /* A pending frame is never overwritten, the caller polls or gives up. */
+    if (nullptr != EmwIoSpi::TxDataAddress) {
+      DEBUG_IO_LOG("EmwIoSpi::sendImp(): %p still pending\n", static_cast<const void *>(EmwIoSpi::TxDataAddress))
+      sent = 0U;
+    }
+    else {
+      EmwIoSpi::TxDataAddress = dataPtr;
+      EmwIoSpi::TxDataLength = dataLength;
+      if (EmwOsInterface::eOK != EmwOsInterface::Notify(EmwIoSpi::TxRxNotification)) {
+        DRIVER_ERROR_VERBOSE("Warning, SPI thread cannot be notified\n")
+      }
+      sent = dataLength;
     }
-    sent = dataLength;
   }
   DEBUG_IO_LOG("\nEmwIoSpi::sendImp()< %" PRIi32 "\n\n", static_cast<std::int32_t>(sent))
   return sent;
@@ -228,7 +297,7 @@ int8_t EmwIoSpi::unInitializeImp(void) noexcept
 void EmwIoSpi::SpiTransferCallback(SPI_HandleTypeDef *spiPtr) noexcept
 {
   static_cast<void>(spiPtr);
-  (void) EmwOsInterface::ReleaseSemaphore(EmwIoSpi::TransferDoneSem);
+  (void) EmwOsInterface::Notify(EmwIoSpi::TransferDoneNotification);
 }
 
 void EmwIoSpi::SpiErrorCallback(SPI_HandleTypeDef *spiPtr) noexcept
@@ -239,19 +308,47 @@ void EmwIoSpi::SpiErrorCallback(SPI_HandleTypeDef *spiPtr) noexcept
 
 void EmwIoSpi::FlowInterruptCallback(void) noexcept
 {
-  (void) EmwOsInterface::ReleaseSemaphore(EmwIoSpi::FowRiseSem);
+  (void) EmwOsInterface::Notify(EmwIoSpi::FlowRiseNotification);
 }
 
 void EmwIoSpi::NotifyInterruptCallback(void) noexcept
 {
-  (void) EmwOsInterface::ReleaseSemaphore(EmwIoSpi::TxRxSem);
+  /* Only the first interrupt before a wake up is stamped. */
+  if (EmwIoSpi::IsWakeLatencyOn && (!EmwIoSpi::IsNotifyStamped)) {
+    EmwIoSpi::NotifyCycles = CycleCounter::Get();
+    EmwIoSpi::IsNotifyStamped = true;
+  }
+  (void) EmwOsInterface::Notify(EmwIoSpi::TxRxNotification);
+}
+
+void EmwIoSpi::StartWakeLatency(void) noexcept
+{
+  CycleCounter::Start();
+  EmwIoSpi::IsWakeLatencyOn = false;
+  EmwIoSpi::IsNotifyStamped = false;
+  EmwIoSpi::WakeLatency.count = 0U;
+  EmwIoSpi::WakeLatency.minCycles = UINT32_MAX;
+  EmwIoSpi::WakeLatency.maxCycles = 0U;
+  EmwIoSpi::WakeLatency.sumCycles = 0U;
+  EmwIoSpi::IsWakeLatencyOn = true;
+}
+
+/* The last wake up can still be counted while the statistics are copied. */
+void EmwIoSpi::StopWakeLatency(EmwIoSpi::WakeLatency_t &wakeLatency) noexcept
+{
+  EmwIoSpi::IsWakeLatencyOn = false;
+  wakeLatency = EmwIoSpi::WakeLatency;
+  if (0U == wakeLatency.count) {
+    wakeLatency.minCycles = 0U;
+  }
 }
 
 std::int8_t EmwIoSpi::waitFlowHigh(void) noexcept
 {
   std::int8_t status = 0;
 
-  if (EmwOsInterface::eOK != EmwOsInterface::TakeSemaphore(EmwIoSpi::FowRiseSem, EmwIoSpi::TIMEOUT_HARDWARE_EMW_MS)) {
+  if (EmwOsInterface::eOK \
+      != EmwOsInterface::WaitNotification(EmwIoSpi::FlowRiseNotification, EmwIoSpi::TIMEOUT_HARDWARE_EMW_MS)) {
     status = -1;
   }
   if (this->isFlowLow()) {
@@ -269,7 +366,7 @@ HAL_StatusTypeDef EmwIoSpi::receive(std::uint8_t *rxDataPtr, std::uint16_t rxDat
   DEBUG_IO_LOG("\nEmwIoSpi::receive()> %" PRIu32 "\n", static_cast<std::uint32_t>(rxDataLength))
 
   status = HAL_SPI_Receive_DMA(this->configuration.hSpiPtr, rxDataPtr, rxDataLength);
-  (void) EmwOsInterface::TakeSemaphore(EmwIoSpi::TransferDoneSem, EmwIoSpi::TIMEOUT_HARDWARE_EMW_MS);
+  (void) EmwOsInterface::WaitNotification(EmwIoSpi::TransferDoneNotification, EmwIoSpi::TIMEOUT_HARDWARE_EMW_MS);
 
 #if defined(DEBUG_DETAILS_IO_LOG)
   for (std::uint32_t i = 0U; i < rxDataLength; i++) {
@@ -293,7 +390,7 @@ HAL_StatusTypeDef EmwIoSpi::transmit(const std::uint8_t *txDataPtr, std::uint16_
 #endif /* DEBUG_DETAILS_IO_LOG */
 
   status = HAL_SPI_Transmit_DMA(this->configuration.hSpiPtr, txDataPtr, dataLength);
-  (void) EmwOsInterface::TakeSemaphore(EmwIoSpi::TransferDoneSem, EmwIoSpi::TIMEOUT_HARDWARE_EMW_MS);
+  (void) EmwOsInterface::WaitNotification(EmwIoSpi::TransferDoneNotification, EmwIoSpi::TIMEOUT_HARDWARE_EMW_MS);
   DEBUG_IO_LOG("\nEmwIoSpi::transmit()<%" PRIi32 "\n\n", static_cast<std::int32_t>(status))
   return status;
 }
@@ -312,7 +409,7 @@ HAL_StatusTypeDef EmwIoSpi::transmitReceive(const std::uint8_t *txDataPtr, std::
 #endif /* DEBUG_DETAILS_IO_LOG */
 
   status = HAL_SPI_TransmitReceive_DMA(this->configuration.hSpiPtr, txDataPtr, rxDataPtr, dataLength);
-  (void) EmwOsInterface::TakeSemaphore(EmwIoSpi::TransferDoneSem, EmwIoSpi::TIMEOUT_HARDWARE_EMW_MS);
+  (void) EmwOsInterface::WaitNotification(EmwIoSpi::TransferDoneNotification, EmwIoSpi::TIMEOUT_HARDWARE_EMW_MS);
   DEBUG_IO_LOG("\nEmwIoSpi::transmitReceive()< %" PRIi32 "\n\n", static_cast<std::int32_t>(status))
   return status;
 }
@@ -393,28 +490,42 @@ void EmwIoSpi::start(void) noexcept
     EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
   }
   {
-    static const char txrx_sem_name[] = {"EMW-SpiTxRxSem"};
-    const EmwOsInterface::Status os_status = EmwOsInterface::CreateSemaphore(EmwIoSpi::TxRxSem, txrx_sem_name, 2U, 0U);
+    static const char txrx_notification_name[] = {"EMW-SpiTxRx"};
+    const EmwOsInterface::Status os_status = EmwOsInterface::CreateNotification(EmwIoSpi::TxRxNotification,
+      txrx_notification_name, EMW_OS_NOTIFICATION_SPI_TXRX, 2U);
+    EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
+  }
+  {
+    static const char flow_rise_notification_name[] = {"EMW-SpiFlowRise"};
+    const EmwOsInterface::Status os_status = EmwOsInterface::CreateNotification(EmwIoSpi::FlowRiseNotification,
+      flow_rise_notification_name, EMW_OS_NOTIFICATION_SPI_FLOW_RISE, 1U);
     EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
   }
   {
-    static const char flow_rise_sem_name[] = {"EMW-SpiFlowRiseSem"};
-    const EmwOsInterface::Status os_status = EmwOsInterface::CreateSemaphore(EmwIoSpi::FowRiseSem,
-      flow_rise_sem_name, 1U, 0U);
+    static const char transfer_done_notification_name[] = {"EMW-SpiTransferDone"};
+    const EmwOsInterface::Status os_status = EmwOsInterface::CreateNotification(EmwIoSpi::TransferDoneNotification,
+      transfer_done_notification_name, EMW_OS_NOTIFICATION_SPI_TRANSFER_DONE, 1U);
     EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
   }
   {
-    static const char transfer_done_sem_name[] = {"EMW-SpiTransferDoneSem"};
-    const EmwOsInterface::Status os_status = EmwOsInterface::CreateSemaphore(EmwIoSpi::TransferDoneSem,
-      transfer_done_sem_name, 1U, 0U);
+    static const char tx_done_sem_name[] = {"EMW-SpiTxDoneSem"};
+    const EmwOsInterface::Status os_status = EmwOsInterface::CreateSemaphore(EmwIoSpi::TxDoneSem,
+      tx_done_sem_name, 1U, 0U);
     EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
   }
 #if defined(EMW_WITH_RTOS)
   {
     static const char io_thread_name[] = {"EMW-SPI_DMA_Thread"};
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+    const EmwOsInterface::Status os_status \
+      = EmwOsInterface::CreateThread(EmwIoSpi::IoThread, io_thread_name, EmwIoSpi::IoThreadFunction, this,
+                                     EMW_IO_SPI_THREAD_STACK_SIZE, EMW_IO_SPI_THREAD_PRIORITY,
+                                     EmwIoSpi::IoThreadStorage, EmwIoSpi::IoThreadStack);
+#else
     const EmwOsInterface::Status os_status \
       = EmwOsInterface::CreateThread(EmwIoSpi::IoThread, io_thread_name, EmwIoSpi::IoThreadFunction, this,
                                      EMW_IO_SPI_THREAD_STACK_SIZE, EMW_IO_SPI_THREAD_PRIORITY);
+#endif /* EMW_OS_WITH_STATIC_ALLOCATION */
     EmwOsInterface::AssertAlways(EmwOsInterface::eOK == os_status);
     /* Be cooperative. */
     EmwOsInterface::DelayTicks(1U);
@@ -441,7 +552,7 @@ void EmwIoSpi::stop(void) noexcept
 #if defined(EMW_WITH_RTOS)
   EmwIoSpi::IoThreadQuitFlag = true;
 #endif /* EMW_WITH_RTOS */
-  (void) EmwOsInterface::ReleaseSemaphore(EmwIoSpi::TxRxSem);
+  (void) EmwOsInterface::Notify(EmwIoSpi::TxRxNotification);
 
 #if defined(EMW_WITH_RTOS)
   while (EmwIoSpi::IoThreadQuitFlag) {
@@ -455,15 +566,23 @@ void EmwIoSpi::stop(void) noexcept
   EmwOsInterface::DelayTicks(1U);
 #endif /* EMW_WITH_RTOS */
 
-  (void) EmwOsInterface::DeleteSemaphore(EmwIoSpi::TransferDoneSem);
-  (void) EmwOsInterface::DeleteSemaphore(EmwIoSpi::FowRiseSem);
-  (void) EmwOsInterface::DeleteSemaphore(EmwIoSpi::TxRxSem);
+  /* A frame still waiting for its transfer is dropped, its data can be freed by the sender. */
+  EmwIoSpi::TxDataAddress = nullptr;
+  EmwIoSpi::TxDataLength = 0U;
+  (void) EmwOsInterface::DeleteSemaphore(EmwIoSpi::TxDoneSem);
+  (void) EmwOsInterface::DeleteNotification(EmwIoSpi::TransferDoneNotification);
+  (void) EmwOsInterface::DeleteNotification(EmwIoSpi::FlowRiseNotification);
+  (void) EmwOsInterface::DeleteNotification(EmwIoSpi::TxRxNotification);
   (void) EmwOsInterface::DeleteMutex(EmwIoSpi::TxLock);
   DEBUG_IO_LOG("\nEmwIoSpi::stop()<\n\n")
 }
 
 #if defined(EMW_WITH_RTOS)
 EmwOsInterface::Thread_t EmwIoSpi::IoThread;
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+EmwOsInterface::ThreadStorage_t EmwIoSpi::IoThreadStorage;
+EmwOsInterface::ThreadStack_t EmwIoSpi::IoThreadStack[EMW_IO_SPI_THREAD_STACK_SIZE];
+#endif /* EMW_OS_WITH_STATIC_ALLOCATION */
 volatile bool EmwIoSpi::IoThreadQuitFlag = false;
 
 void EmwIoSpi::IoThreadFunction(EmwOsInterface::ThreadFunctionArgument_t argumentPtr) noexcept
@@ -475,6 +594,10 @@ void EmwIoSpi::IoThreadFunction(EmwOsInterface::ThreadFunctionArgument_t argumen
   {
     EmwIoSpi * const THIS = static_cast<EmwIoSpi *>(const_cast<void *>(argumentPtr));
 
+    /* The interrupts and the senders wake up this thread only. */
+    EmwOsInterface::ArmNotification(EmwIoSpi::TxRxNotification);
+    EmwOsInterface::ArmNotification(EmwIoSpi::FlowRiseNotification);
+    EmwOsInterface::ArmNotification(EmwIoSpi::TransferDoneNotification);
     EmwIoSpi::IoThreadQuitFlag = false;
     while (!EmwIoSpi::IoThreadQuitFlag) {
       THIS->processPollingData(EMW_OS_TIMEOUT_FOREVER);
@@ -485,9 +608,15 @@ void EmwIoSpi::IoThreadFunction(EmwOsInterface::ThreadFunctionArgument_t argumen
 }
 #endif /* EMW_WITH_RTOS */
 
-EmwOsInterface::Semaphore_t EmwIoSpi::FowRiseSem;
-EmwOsInterface::Semaphore_t EmwIoSpi::TransferDoneSem;
+EmwOsInterface::Notification_t EmwIoSpi::FlowRiseNotification;
+EmwOsInterface::Notification_t EmwIoSpi::TransferDoneNotification;
 const std::uint8_t *EmwIoSpi::TxDataAddress = nullptr;
 std::uint16_t EmwIoSpi::TxDataLength = 0U;
+EmwOsInterface::Semaphore_t EmwIoSpi::TxDoneSem;
 EmwOsInterface::Mutex_t EmwIoSpi::TxLock;
-EmwOsInterface::Semaphore_t EmwIoSpi::TxRxSem;
+EmwOsInterface::Notification_t EmwIoSpi::TxRxNotification;
+volatile bool EmwIoSpi::IsWakeLatencyOn = false;
+volatile bool EmwIoSpi::IsNotifyStamped = false;
+volatile std::uint32_t EmwIoSpi::NotifyCycles = 0U;
+EmwIoSpi::WakeLatency_t EmwIoSpi::WakeLatency = {0U, 0U, 0U, 0U};
+std::uint8_t EmwIoSpi::RxScratch[EMW_IO_SPI_RX_SCRATCH_SIZE];
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "EmwIoInterface.hpp"
+#include "EmwNetworkStack.hpp"
 #include "EmwOsInterface.hpp"
 #include "stm32u5xx_hal.h"
 #include <cstdint>
@@ -34,6 +35,8 @@ class EmwIoSpi final : public EmwIoInterface<EmwIoSpi> {
     void pollDataImp(std::uint32_t timeoutInMs) noexcept;
   public:
     void processPollingDataImp(std::uint32_t timeoutInMs) noexcept;
+  public:
+    bool isSendingImp(const std::uint8_t *dataPtr) const noexcept;
   public:
     std::uint16_t sendImp(const std::uint8_t *dataPtr, std::uint16_t dataLength) noexcept;
   public:
@@ -61,6 +64,23 @@ class EmwIoSpi final : public EmwIoInterface<EmwIoSpi> {
       std::uint16_t resetPin;
     };
 
+  public:
+    typedef struct {
+      std::uint32_t count;
+      std::uint32_t minCycles;
+      std::uint32_t maxCycles;
+      std::uint64_t sumCycles;
+    } WakeLatency_t;
+  public:
+    /* Times, in core cycles, the notify line interrupt to the IO thread waking up for it. Off by default. */
+    static void StartWakeLatency(void) noexcept;
+  public:
+    static void StopWakeLatency(WakeLatency_t &wakeLatency) noexcept;
+
+  private:
+    EmwNetworkStack::Buffer_t *allocReceiveBuffer(std::uint16_t length) noexcept;
+  private:
+    HAL_StatusTypeDef discard(std::uint16_t rxDataLength) noexcept;
   private:
     std::int32_t exchangeHeaders(std::uint16_t txLength, std::uint16_t &rxLength) noexcept;
   private:
@@ -90,6 +110,12 @@ class EmwIoSpi final : public EmwIoInterface<EmwIoSpi> {
 #if defined(EMW_WITH_RTOS)
   private:
     static EmwOsInterface::Thread_t IoThread;
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+  private:
+    static EmwOsInterface::ThreadStorage_t IoThreadStorage;
+  private:
+    static EmwOsInterface::ThreadStack_t IoThreadStack[EMW_IO_SPI_THREAD_STACK_SIZE];
+#endif /* EMW_OS_WITH_STATIC_ALLOCATION */
   private:
     static volatile bool IoThreadQuitFlag;
   private:
@@ -108,17 +134,29 @@ class EmwIoSpi final : public EmwIoInterface<EmwIoSpi> {
   private:
     struct Stm32Hw_s configuration;
   private:
-    static EmwOsInterface::Semaphore_t FowRiseSem;
+    static EmwOsInterface::Notification_t FlowRiseNotification;
   private:
-    static EmwOsInterface::Semaphore_t TransferDoneSem;
+    static EmwOsInterface::Notification_t TransferDoneNotification;
   private:
     static const std::uint8_t *TxDataAddress;
   private:
     static std::uint16_t TxDataLength;
+  private:
+    static EmwOsInterface::Semaphore_t TxDoneSem;
   private:
     static EmwOsInterface::Mutex_t TxLock;
   private:
-    static EmwOsInterface::Semaphore_t TxRxSem;
+    static EmwOsInterface::Notification_t TxRxNotification;
+  private:
+    static std::uint8_t RxScratch[EMW_IO_SPI_RX_SCRATCH_SIZE];
+  private:
+    static volatile bool IsWakeLatencyOn;
+  private:
+    static volatile bool IsNotifyStamped;
+  private:
+    static volatile std::uint32_t NotifyCycles;
+  private:
+    static WakeLatency_t WakeLatency;
   private:
     static const std::uint16_t SPI_MAX_BYTE_COUNT = 2500U;
   private:
@@ -25,13 +25,39 @@
 #endif /* EMW_IO_DEBUG */
 
 
-EmwNetworkStack::Buffer_t *EmwNetworkStack::AllocBuffer(void) noexcept
+#define NETWORK_BUFFER_SIZE_DEFINED (2500U)
+#define NETWORK_BLOCK_SIZE       (((sizeof(EmwBuffer_t) - 1U + NETWORK_BUFFER_SIZE_DEFINED) + 3U) & ~3U)
+#define NETWORK_SMALL_BLOCK_SIZE (((sizeof(EmwBuffer_t) - 1U + EMW_NETWORK_SMALL_BUFFER_SIZE) + 3U) & ~3U)
+
+alignas(4) static std::uint8_t BufferPoolStorage[EMW_NETWORK_BUFFER_POOL_COUNT][NETWORK_BLOCK_SIZE];
+alignas(4) static std::uint8_t SmallBufferPoolStorage[EMW_NETWORK_SMALL_BUFFER_POOL_COUNT][NETWORK_SMALL_BLOCK_SIZE];
+
+EmwNetworkStack::Pool_t EmwNetworkStack::BufferPool(&BufferPoolStorage[0][0],
+    NETWORK_BLOCK_SIZE, EMW_NETWORK_BUFFER_POOL_COUNT);
+EmwNetworkStack::Pool_t EmwNetworkStack::SmallBufferPool(&SmallBufferPoolStorage[0][0],
+    NETWORK_SMALL_BLOCK_SIZE, EMW_NETWORK_SMALL_BUFFER_POOL_COUNT);
+
+/* The buffers come from the pool of their size class, the heap is only used when that pool is exhausted. */
+EmwNetworkStack::Buffer_t *EmwNetworkStack::AllocBuffer(std::uint32_t size) noexcept
 {
-  EmwNetworkStack::Buffer_t *const network_packet_ptr \
-    = static_cast<EmwBuffer_t *>(EmwOsInterface::Malloc(EmwNetworkStack::NETWORK_BUFFER_SIZE + sizeof(EmwBuffer_t) - 1U));
+  EmwNetworkStack::Buffer_t *network_packet_ptr = nullptr;
 
+  if (EmwNetworkStack::NETWORK_BUFFER_SIZE >= size) {
+    if (EMW_NETWORK_SMALL_BUFFER_SIZE >= size) {
+      network_packet_ptr = static_cast<EmwBuffer_t *>(EmwNetworkStack::AllocBlock(EmwNetworkStack::SmallBufferPool));
+    }
+    else {
+      network_packet_ptr = static_cast<EmwBuffer_t *>(EmwNetworkStack::AllocBlock(EmwNetworkStack::BufferPool));
+    }
+    if (nullptr == network_packet_ptr) {
+      network_packet_ptr = static_cast<EmwBuffer_t *>(EmwOsInterface::Malloc(size + sizeof(EmwBuffer_t) - 1U));
+    }
+  }
   if (nullptr != network_packet_ptr) {
-    network_packet_ptr->length = EmwNetworkStack::NETWORK_BUFFER_SIZE;
+    if (EMW_NETWORK_SMALL_BUFFER_SIZE >= size) {
+      EMW_STATS_INCREMENT(allocSmall)
+    }
+    network_packet_ptr->length = size;
     network_packet_ptr->headerLength = 0U;
 
     DEBUG_IO_LOG("\nEmwNetworkStack::AllocBuffer(): allocated %p (%" PRIu32 ")\n",
@@ -46,10 +72,65 @@ void EmwNetworkStack::FreeBuffer(EmwNetworkStack::Buffer_t *networkPacketPtr) no
 {
   DEBUG_IO_LOG("\nEmwNetworkStack::FreeBuffer(): releasing %p\n", static_cast<const void *>(networkPacketPtr))
 
-  EmwOsInterface::Free(static_cast<void *>(networkPacketPtr));
+  if ((!EmwNetworkStack::FreeBlock(EmwNetworkStack::BufferPool, networkPacketPtr)) \
+      && (!EmwNetworkStack::FreeBlock(EmwNetworkStack::SmallBufferPool, networkPacketPtr))) {
+    EmwOsInterface::Free(static_cast<void *>(networkPacketPtr));
+  }
   EMW_STATS_INCREMENT(free)
 }
 
+void EmwNetworkStack::GetPoolStatistics(EmwNetworkStack::PoolStatistics_t &statistics,
+                                        EmwNetworkStack::PoolStatistics_t &smallStatistics) noexcept
+{
+  EmwOsInterface::Lock();
+  statistics = EmwNetworkStack::BufferPool.statistics;
+  smallStatistics = EmwNetworkStack::SmallBufferPool.statistics;
+  EmwOsInterface::UnLock();
+}
+
+void *EmwNetworkStack::AllocBlock(EmwNetworkStack::Pool_t &pool) noexcept
+{
+  void *block_ptr = nullptr;
+
+  EmwOsInterface::Lock();
+  if (nullptr != pool.freeListPtr) {
+    block_ptr = pool.freeListPtr;
+    pool.freeListPtr = *static_cast<void **>(block_ptr);
+  }
+  else if (0U != pool.untouchedCount) {
+    block_ptr = &pool.storagePtr[(pool.statistics.blockCount - pool.untouchedCount) * pool.statistics.blockSize];
+    pool.untouchedCount--;
+  }
+  if (nullptr != block_ptr) {
+    pool.statistics.used++;
+    if (pool.statistics.highWaterMark < pool.statistics.used) {
+      pool.statistics.highWaterMark = pool.statistics.used;
+    }
+  }
+  else {
+    pool.statistics.exhausted++;
+  }
+  EmwOsInterface::UnLock();
+  return block_ptr;
+}
+
+/* Returns false when the block is not one of the pool. */
+bool EmwNetworkStack::FreeBlock(EmwNetworkStack::Pool_t &pool, void *blockPtr) noexcept
+{
+  const std::uint8_t * const byte_ptr = static_cast<const std::uint8_t *>(blockPtr);
+  const bool is_owned = (byte_ptr >= pool.storagePtr) \
+                        && (byte_ptr < &pool.storagePtr[pool.statistics.blockCount * pool.statistics.blockSize]);
+
+  if (is_owned) {
+    EmwOsInterface::Lock();
+    *static_cast<void **>(blockPtr) = pool.freeListPtr;
+    pool.freeListPtr = blockPtr;
+    pool.statistics.used--;
+    EmwOsInterface::UnLock();
+  }
+  return is_owned;
+}
+
 std::uint8_t *EmwNetworkStack::GetBufferPayload(EmwNetworkStack::Buffer_t *networkPacketPtr) noexcept
 {
   return &networkPacketPtr->data[networkPacketPtr->headerLength];
@@ -71,6 +152,5 @@ void EmwNetworkStack::HideBufferHeader(EmwNetworkStack::Buffer_t *networkPacketP
   networkPacketPtr->headerLength += size;
 }
 
-#define NETWORK_BUFFER_SIZE_DEFINED (2500U)
 const std::uint16_t EmwNetworkStack::NETWORK_BUFFER_SIZE = NETWORK_BUFFER_SIZE_DEFINED;
 const std::uint16_t EmwNetworkStack::NETWORK_IPC_PAYLOAD_SIZE = NETWORK_BUFFER_SIZE_DEFINED - 6U;
@@ -34,13 +34,25 @@
 #error "EMW_NETWORK_BYPASS_HEADER_SIZE_DEFINED must be equal to PBUF_LINK_ENCAPSULATION_HLEN."
 #endif /* EMW_NETWORK_BYPASS_HEADER_SIZE */
 
-EmwNetworkStack::Buffer_t *EmwNetworkStack::AllocBuffer(void) noexcept
+/* The small size class is taken from the lwIP heap at the exact size, the large one is a full entry of the pool.
+ * A small buffer falls back to the pool when the heap is exhausted.
+ */
+EmwNetworkStack::Buffer_t *EmwNetworkStack::AllocBuffer(std::uint32_t size) noexcept
 {
-  struct pbuf *const network_packet_ptr = pbuf_alloc(PBUF_RAW, EmwNetworkStack::NETWORK_BUFFER_SIZE, PBUF_POOL);
+  struct pbuf *network_packet_ptr = nullptr;
 
+  if (EMW_NETWORK_SMALL_BUFFER_SIZE >= size) {
+    network_packet_ptr = pbuf_alloc(PBUF_RAW, static_cast<u16_t>(size), PBUF_RAM);
+    if (nullptr != network_packet_ptr) {
+      EMW_STATS_INCREMENT(allocSmall)
+    }
+  }
+  if ((nullptr == network_packet_ptr) && (EmwNetworkStack::NETWORK_BUFFER_SIZE >= size)) {
+    network_packet_ptr = pbuf_alloc(PBUF_RAW, EmwNetworkStack::NETWORK_BUFFER_SIZE, PBUF_POOL);
+  }
   if (nullptr != network_packet_ptr) {
     DEBUG_IO_LOG("\nEmwNetworkStack::AllocBuffer(): allocated %p (%" PRIu32 ")\n",
-                 static_cast<const void *>(network_packet_ptr), static_cast<std::uint32_t>(EmwNetworkStack::NETWORK_BUFFER_SIZE))
+                 static_cast<const void *>(network_packet_ptr), static_cast<std::uint32_t>(network_packet_ptr->len))
 
     EMW_STATS_INCREMENT(alloc)
   }
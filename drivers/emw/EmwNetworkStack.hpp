@@ -50,7 +50,8 @@ class EmwNetworkStack final {
   private:
     EmwNetworkStack(void) {};
   public:
-    static EmwNetworkStack::Buffer_t *AllocBuffer(void) noexcept;
+    /* The buffers up to EMW_NETWORK_SMALL_BUFFER_SIZE come from the small size class. */
+    static EmwNetworkStack::Buffer_t *AllocBuffer(std::uint32_t size) noexcept;
   public:
     static void FreeBuffer(EmwNetworkStack::Buffer_t *networkPacketPtr) noexcept;
   public:
@@ -69,4 +70,48 @@ class EmwNetworkStack final {
   public:
     static const std::uint16_t NETWORK_MTU_SIZE;
 #endif /* COMPILATION_WITH_LWIP */
+
+#if defined(EMW_NETWORK_EMW_MODE)
+  public:
+    typedef struct PoolStatistics_s {
+      constexpr PoolStatistics_s(void) noexcept
+        : blockSize(0U), blockCount(0U), used(0U), highWaterMark(0U), exhausted(0U) {}
+      std::uint32_t blockSize;
+      std::uint32_t blockCount;
+      std::uint32_t used;
+      std::uint32_t highWaterMark;
+      std::uint32_t exhausted;
+    } PoolStatistics_t;
+
+  public:
+    static void GetPoolStatistics(EmwNetworkStack::PoolStatistics_t &statistics,
+                                  EmwNetworkStack::PoolStatistics_t &smallStatistics) noexcept;
+
+  private:
+    /* Fixed size blocks, chained by their first word when free.
+     * The blocks never used yet are taken in order, so the pool needs no initialization.
+     */
+    typedef struct Pool_s {
+      constexpr Pool_s(std::uint8_t *storagePtr, std::uint32_t blockSize, std::uint32_t blockCount) noexcept
+        : storagePtr(storagePtr), freeListPtr(nullptr), untouchedCount(blockCount), statistics()
+      {
+        this->statistics.blockSize = blockSize;
+        this->statistics.blockCount = blockCount;
+      }
+      std::uint8_t *storagePtr;
+      void *freeListPtr;
+      std::uint32_t untouchedCount;
+      EmwNetworkStack::PoolStatistics_t statistics;
+    } Pool_t;
+
+  private:
+    static void *AllocBlock(EmwNetworkStack::Pool_t &pool) noexcept;
+  private:
+    static bool FreeBlock(EmwNetworkStack::Pool_t &pool, void *blockPtr) noexcept;
+
+  private:
+    static EmwNetworkStack::Pool_t BufferPool;
+  private:
+    static EmwNetworkStack::Pool_t SmallBufferPool;
+#endif /* EMW_NETWORK_EMW_MODE */
 };
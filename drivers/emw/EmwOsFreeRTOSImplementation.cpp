@@ -39,6 +39,13 @@ static const TickType_t GIVE_BLOCK_TIME = 0U; /* semGIVE_BLOCK_TIME */
 static const std::uint8_t QUEUE_TYPE_BASE = 0U; /* queueQUEUE_TYPE_BASE */
 static const std::uint8_t QUEUE_TYPE_RECURSIVE_MUTEX = 4U; /* queueQUEUE_TYPE_RECURSIVE_MUTEX */
 static const BaseType_t SEND_TO_BACK = 0; /* queueSEND_TO_BACK */
+static const std::uint32_t NOTIFICATION_CLEAR_ALL = UINT32_MAX;
+
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+#define OS_HANDLE(OBJECT) ((OBJECT).handle)
+#else
+#define OS_HANDLE(OBJECT) (OBJECT)
+#endif /* EMW_OS_WITH_STATIC_ALLOCATION */
 
 static inline std::uint32_t MilliSecondsToTicks(std::uint32_t timeoutInMs);
 
@@ -91,7 +98,15 @@ EmwOsInterface::Status EmwOsInterface::CreateSemaphore(EmwOsInterface::Semaphore
   EMW_OS_DEBUG_LOG("\n EmwOsInterface::CreateSemaphore()> \"%s\"\n",
                    (nullptr != semaphoreNamePtr) ? semaphoreNamePtr : "")
 
-#if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+  const QueueHandle_t queue = xQueueCreateCountingSemaphoreStatic(maxCount, initialCount, &semaphore.storage);
+
+  if (nullptr != queue) {
+    semaphore.handle = queue;
+    vQueueAddToRegistry(queue, (nullptr != semaphoreNamePtr) ? semaphoreNamePtr : "");
+    status = EmwOsInterface::eOK;
+  }
+#elif (configSUPPORT_DYNAMIC_ALLOCATION == 1)
   const QueueHandle_t queue = xQueueCreateCountingSemaphore(maxCount, initialCount);
 
   if (nullptr != queue) {
@@ -108,7 +123,7 @@ EmwOsInterface::Status EmwOsInterface::TakeSemaphore(EmwOsInterface::Semaphore_t
 {
   EmwOsInterface::Status status;
 
-  if (PASS == xQueueSemaphoreTake(semaphore, MilliSecondsToTicks(timeoutInMs))) {
+  if (PASS == xQueueSemaphoreTake(OS_HANDLE(semaphore), MilliSecondsToTicks(timeoutInMs))) {
     status = EmwOsInterface::eOK;
   }
   else {
@@ -124,7 +139,7 @@ EmwOsInterface::Status EmwOsInterface::ReleaseSemaphore(EmwOsInterface::Semaphor
   if (TRUE == xPortIsInsideInterrupt()) {
     BaseType_t yield = FALSE;
 
-    if (TRUE == xQueueGiveFromISR(semaphore, &yield)) {
+    if (TRUE == xQueueGiveFromISR(OS_HANDLE(semaphore), &yield)) {
       if (TRUE == yield) {
         taskYIELD();
       }
@@ -132,7 +147,7 @@ EmwOsInterface::Status EmwOsInterface::ReleaseSemaphore(EmwOsInterface::Semaphor
     }
   }
   else {
-    if (PASS == xQueueGenericSend(semaphore, nullptr, GIVE_BLOCK_TIME, SEND_TO_BACK)) {
+    if (PASS == xQueueGenericSend(OS_HANDLE(semaphore), nullptr, GIVE_BLOCK_TIME, SEND_TO_BACK)) {
       status = EmwOsInterface::eOK;
     }
   }
@@ -141,10 +156,84 @@ EmwOsInterface::Status EmwOsInterface::ReleaseSemaphore(EmwOsInterface::Semaphor
 
 void EmwOsInterface::DeleteSemaphore(EmwOsInterface::Semaphore_t &semaphore) noexcept
 {
-  EMW_OS_DEBUG_LOG("\n EmwOsInterface::DeleteSemaphore()> \"%s\"\n", pcQueueGetName(semaphore))
+  EMW_OS_DEBUG_LOG("\n EmwOsInterface::DeleteSemaphore()> \"%s\"\n", pcQueueGetName(OS_HANDLE(semaphore)))
+
+  vQueueUnregisterQueue(OS_HANDLE(semaphore));
+  vQueueDelete(OS_HANDLE(semaphore));
+}
+
+EmwOsInterface::Status EmwOsInterface::CreateNotification(EmwOsInterface::Notification_t &notification,
+    const char *notificationNamePtr, std::uint32_t index, std::uint32_t maxCount) noexcept
+{
+  EmwOsInterface::Status status = EmwOsInterface::eERROR;
 
-  vQueueUnregisterQueue(semaphore);
-  vQueueDelete(semaphore);
+  EMW_OS_DEBUG_LOG("\n EmwOsInterface::CreateNotification()> \"%s\"\n",
+                   (nullptr != notificationNamePtr) ? notificationNamePtr : "")
+  static_cast<void>(notificationNamePtr);
+
+  notification.waiter = nullptr;
+  if ((0U < index) && (index < static_cast<std::uint32_t>(configTASK_NOTIFICATION_ARRAY_ENTRIES))) {
+    notification.index = static_cast<UBaseType_t>(index);
+    notification.maxCount = (1U < maxCount) ? maxCount : 1U;
+    status = EmwOsInterface::eOK;
+  }
+  return status;
+}
+
+void EmwOsInterface::ArmNotification(EmwOsInterface::Notification_t &notification) noexcept
+{
+  notification.waiter = xTaskGetCurrentTaskHandle();
+  (void) xTaskGenericNotifyStateClear(nullptr, notification.index);
+  (void) ulTaskGenericNotifyValueClear(nullptr, notification.index, NOTIFICATION_CLEAR_ALL);
+}
+
+EmwOsInterface::Status EmwOsInterface::WaitNotification(EmwOsInterface::Notification_t &notification,
+    std::uint32_t timeoutInMs) noexcept
+{
+  EmwOsInterface::Status status = EmwOsInterface::eERROR;
+
+  /* The interrupt side can only increment the count, so the count is clamped here: it is taken as a whole,
+   * and what is left of it within the maximum count is given back to the calling thread.
+   */
+  std::uint32_t count = ulTaskGenericNotifyTake(notification.index, TRUE, MilliSecondsToTicks(timeoutInMs));
+
+  if (0U != count) {
+    if (count > notification.maxCount) {
+      count = notification.maxCount;
+    }
+    for (; 1U < count; count--) {
+      (void) xTaskGenericNotify(xTaskGetCurrentTaskHandle(), notification.index, 0U, eIncrement, nullptr);
+    }
+    status = EmwOsInterface::eOK;
+  }
+  return status;
+}
+
+EmwOsInterface::Status EmwOsInterface::Notify(EmwOsInterface::Notification_t &notification) noexcept
+{
+  EmwOsInterface::Status status = EmwOsInterface::eERROR;
+  const TaskHandle_t waiter = notification.waiter;
+
+  if (nullptr != waiter) {
+    if (TRUE == xPortIsInsideInterrupt()) {
+      BaseType_t yield = FALSE;
+
+      vTaskGenericNotifyGiveFromISR(waiter, notification.index, &yield);
+      portYIELD_FROM_ISR(yield);
+      status = EmwOsInterface::eOK;
+    }
+    else {
+      if (PASS == xTaskGenericNotify(waiter, notification.index, 0U, eIncrement, nullptr)) {
+        status = EmwOsInterface::eOK;
+      }
+    }
+  }
+  return status;
+}
+
+void EmwOsInterface::DeleteNotification(EmwOsInterface::Notification_t &notification) noexcept
+{
+  notification.waiter = nullptr;
 }
 
 EmwOsInterface::Status EmwOsInterface::CreateMutex(EmwOsInterface::Mutex_t &mutex, const char *mutexNamePtr) noexcept
@@ -153,7 +242,17 @@ EmwOsInterface::Status EmwOsInterface::CreateMutex(EmwOsInterface::Mutex_t &mute
 
   EMW_OS_DEBUG_LOG("\n EmwOsInterface::CreateMutex()> \"%s\"\n", (nullptr != mutexNamePtr) ? mutexNamePtr : "")
 
-#if ((configSUPPORT_DYNAMIC_ALLOCATION == 1))
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+  {
+    const QueueHandle_t queue = xQueueCreateMutexStatic(QUEUE_TYPE_RECURSIVE_MUTEX, &mutex.storage);
+
+    if (nullptr != queue) {
+      mutex.handle = queue;
+      vQueueAddToRegistry(queue, (nullptr != mutexNamePtr) ? mutexNamePtr : "");
+      status = EmwOsInterface::eOK;
+    }
+  }
+#elif ((configSUPPORT_DYNAMIC_ALLOCATION == 1))
   {
     const QueueHandle_t queue = xQueueCreateMutex(QUEUE_TYPE_RECURSIVE_MUTEX);
 
@@ -171,7 +270,7 @@ EmwOsInterface::Status EmwOsInterface::TakeMutex(EmwOsInterface::Mutex_t &mutex,
 {
   EmwOsInterface::Status status;
 
-  if (PASS == xQueueTakeMutexRecursive(mutex, MilliSecondsToTicks(timeoutInMs))) {
+  if (PASS == xQueueTakeMutexRecursive(OS_HANDLE(mutex), MilliSecondsToTicks(timeoutInMs))) {
     status = EmwOsInterface::eOK;
   }
   else {
@@ -184,7 +283,7 @@ EmwOsInterface::Status EmwOsInterface::ReleaseMutex(EmwOsInterface::Mutex_t &mut
 {
   EmwOsInterface::Status status;
 
-  if (PASS == xQueueGiveMutexRecursive(mutex)) {
+  if (PASS == xQueueGiveMutexRecursive(OS_HANDLE(mutex))) {
     status = EmwOsInterface::eOK;
   }
   else {
@@ -195,10 +294,10 @@ EmwOsInterface::Status EmwOsInterface::ReleaseMutex(EmwOsInterface::Mutex_t &mut
 
 void EmwOsInterface::DeleteMutex(EmwOsInterface::Mutex_t &mutex) noexcept
 {
-  EMW_OS_DEBUG_LOG("\n EmwOsInterface::DeleteMutex()> \"%s\"\n", pcQueueGetName(mutex))
+  EMW_OS_DEBUG_LOG("\n EmwOsInterface::DeleteMutex()> \"%s\"\n", pcQueueGetName(OS_HANDLE(mutex)))
 
-  vQueueUnregisterQueue(mutex);
-  vQueueDelete(mutex);
+  vQueueUnregisterQueue(OS_HANDLE(mutex));
+  vQueueDelete(OS_HANDLE(mutex));
 }
 
 EmwOsInterface::Status EmwOsInterface::CreateMessageQueue(EmwOsInterface::Queue_t &queue, const char *queueNamePtr,
@@ -289,6 +388,30 @@ EmwOsInterface::Status EmwOsInterface::CreateThread(EmwOsInterface::Thread_t &th
   return status;
 }
 
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+EmwOsInterface::Status EmwOsInterface::CreateThread(EmwOsInterface::Thread_t &thread, const char *threadNamePtr,
+    EmwOsInterface::ThreadFunction_t function, EmwOsInterface::ThreadFunctionArgument_t argument,
+    std::uint32_t stackSize, EmwOsInterface::ThreadPriority_t priority,
+    EmwOsInterface::ThreadStorage_t &storage, EmwOsInterface::ThreadStack_t (&stack)[]) noexcept
+{
+  EmwOsInterface::Status status = EmwOsInterface::eERROR;
+
+  EMW_OS_DEBUG_LOG("\n EmwOsInterface::CreateThread()> \"%s\"\n", (nullptr != threadNamePtr) ? threadNamePtr : "")
+
+  if ((EMW_OS_MINIMAL_THREAD_STACK_SIZE <= stackSize)) {
+    const TaskHandle_t the_thread \
+      = xTaskCreateStatic(reinterpret_cast<TaskFunction_t>(function), (nullptr != threadNamePtr) ? threadNamePtr : "",
+                          static_cast<configSTACK_DEPTH_TYPE>(stackSize), const_cast<void *>(argument),
+                          static_cast<UBaseType_t>(priority), &stack[0], &storage);
+
+    EmwOsInterface::AssertAlways(nullptr != the_thread);
+    thread = the_thread;
+    status = EmwOsInterface::eOK;
+  }
+  return status;
+}
+#endif /* EMW_OS_WITH_STATIC_ALLOCATION */
+
 __NO_RETURN void EmwOsInterface::ExitThread(void) noexcept
 {
   vTaskDelete(nullptr);
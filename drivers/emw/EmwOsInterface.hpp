@@ -18,6 +18,7 @@
   */
 #pragma once
 
+#include "emw_conf.hpp"
 #include <cstddef>
 #include <cstdint>
 
@@ -32,6 +33,9 @@
 #define RTOS_NAME_STRING "FreeRTOS" "(" tskKERNEL_VERSION_NUMBER  ")"
 #define EMW_OS_TIMEOUT_FOREVER UINT32_MAX
 #define EMW_OS_MINIMAL_THREAD_STACK_SIZE (360U + 128U) /**< BUFSIZE + 128 x 32-bit words at least. */
+#if defined(EMW_OS_STATIC_ALLOCATION) && (configSUPPORT_STATIC_ALLOCATION == 1)
+#define EMW_OS_WITH_STATIC_ALLOCATION
+#endif /* EMW_OS_STATIC_ALLOCATION */
 
 #elif defined(COMPILATION_WITH_NO_OS)
 #define EMW_WITH_NO_OS
@@ -51,11 +55,27 @@ class EmwOsInterface final {
 
 #if defined(COMPILATION_WITH_FREERTOS)
     typedef UBaseType_t ThreadPriority_t;
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+    /* The semaphores and the mutexes hold their control block, so their owner holds it. */
+    typedef struct {
+      QueueHandle_t handle;
+      StaticSemaphore_t storage;
+    } Semaphore_t;
+    typedef EmwOsInterface::Semaphore_t Mutex_t;
+    typedef StaticTask_t ThreadStorage_t;
+    typedef StackType_t ThreadStack_t;
+#else
     typedef QueueHandle_t Semaphore_t;
     typedef QueueHandle_t Mutex_t;
+#endif /* EMW_OS_WITH_STATIC_ALLOCATION */
     typedef TaskHandle_t Thread_t;
     typedef const void *ThreadFunctionArgument_t;
     typedef QueueHandle_t Queue_t;
+    typedef struct {
+      volatile TaskHandle_t waiter;
+      UBaseType_t index;
+      std::uint32_t maxCount;
+    } Notification_t;
 
 #elif defined(COMPILATION_WITH_NO_OS)
     typedef void (*RunnerHook_t)(void *THIS, const void *argumentPtr, std::uint32_t timeoutInMs);
@@ -90,6 +110,7 @@ class EmwOsInterface final {
       void *waiterRunnerThis;
       const void *waiterRunnerArgumentPtr;
     } Queue_t;
+    typedef EmwOsInterface::Semaphore_t Notification_t;
 #endif /* COMPILATION_WITH_FREERTOS */
 
     typedef void (*ThreadFunction_t)(EmwOsInterface::ThreadFunctionArgument_t argument);
@@ -112,6 +133,31 @@ class EmwOsInterface final {
                                    void *THIS, const void *argumentPtr) noexcept;
 #endif /* EMW_WITH_NO_OS */
 
+  public:
+    /* A notification wakes up a single thread, the last one that armed it, and takes no object of the RTOS.
+     * The index selects the entry in the notification array of that thread.
+     * With a maximum count above 1, the notifications given meanwhile are counted, as with a semaphore,
+     * and the ones above the maximum count are dropped.
+     */
+    static Status CreateNotification(EmwOsInterface::Notification_t &notification, const char *notificationNamePtr,
+                                     std::uint32_t index, std::uint32_t maxCount) noexcept;
+  public:
+    /* The calling thread becomes the waiter, and the notifications given before are dropped. */
+    static void ArmNotification(EmwOsInterface::Notification_t &notification) noexcept;
+  public:
+    static Status WaitNotification(EmwOsInterface::Notification_t &notification, std::uint32_t timeoutInMs) noexcept;
+  public:
+    /* Can be called from an interrupt. */
+    static Status Notify(EmwOsInterface::Notification_t &notification) noexcept;
+  public:
+    static void DeleteNotification(EmwOsInterface::Notification_t &notification) noexcept;
+
+#if defined(EMW_WITH_NO_OS)
+  public:
+    static Status AddNotificationHook(EmwOsInterface::Notification_t &notification, EmwOsInterface::RunnerHook_t waiter,
+                                      void *THIS, const void *argumentPtr) noexcept;
+#endif /* EMW_WITH_NO_OS */
+
   public:
     static Status CreateMutex(EmwOsInterface::Mutex_t &mutex, const char *mutexNamePtr) noexcept;
   public:
@@ -141,6 +187,14 @@ class EmwOsInterface final {
     static Status CreateThread(EmwOsInterface::Thread_t &thread, const char *threadNamePtr,
                                EmwOsInterface::ThreadFunction_t function, EmwOsInterface::ThreadFunctionArgument_t argument,
                                std::uint32_t stackSize, EmwOsInterface::ThreadPriority_t priority) noexcept;
+#if defined(EMW_OS_WITH_STATIC_ALLOCATION)
+  public:
+    /* The stack array holds stackSize words. */
+    static Status CreateThread(EmwOsInterface::Thread_t &thread, const char *threadNamePtr,
+                               EmwOsInterface::ThreadFunction_t function, EmwOsInterface::ThreadFunctionArgument_t argument,
+                               std::uint32_t stackSize, EmwOsInterface::ThreadPriority_t priority,
+                               EmwOsInterface::ThreadStorage_t &storage, EmwOsInterface::ThreadStack_t (&stack)[]) noexcept;
+#endif /* EMW_OS_WITH_STATIC_ALLOCATION */
   public:
     static /*__NO_RETURN*/ /*status_t*/ void ExitThread(void) noexcept;
   public:
@@ -135,6 +135,42 @@ EmwOsInterface::Status EmwOsInterface::AddSemaphoreHook(EmwOsInterface::Semaphor
   return EmwOsInterface::eOK;
 }
 
+/* Without RTOS there is a single thread, a notification is a semaphore. */
+EmwOsInterface::Status EmwOsInterface::CreateNotification(EmwOsInterface::Notification_t &notification,
+    const char *notificationNamePtr, std::uint32_t index, std::uint32_t maxCount) noexcept
+{
+  static_cast<void>(index);
+  return EmwOsInterface::CreateSemaphore(notification, notificationNamePtr, maxCount, 0U);
+}
+
+void EmwOsInterface::ArmNotification(EmwOsInterface::Notification_t &notification) noexcept
+{
+  __DMB();
+  notification.count = 0U;
+}
+
+EmwOsInterface::Status EmwOsInterface::WaitNotification(EmwOsInterface::Notification_t &notification,
+    std::uint32_t timeoutInMs) noexcept
+{
+  return EmwOsInterface::TakeSemaphore(notification, timeoutInMs);
+}
+
+EmwOsInterface::Status EmwOsInterface::Notify(EmwOsInterface::Notification_t &notification) noexcept
+{
+  return EmwOsInterface::ReleaseSemaphore(notification);
+}
+
+void EmwOsInterface::DeleteNotification(EmwOsInterface::Notification_t &notification) noexcept
+{
+  EmwOsInterface::DeleteSemaphore(notification);
+}
+
+EmwOsInterface::Status EmwOsInterface::AddNotificationHook(EmwOsInterface::Notification_t &notification,
+    EmwOsInterface::RunnerHook_t waiter, void *THIS, const void *argumentPtr) noexcept
+{
+  return EmwOsInterface::AddSemaphoreHook(notification, waiter, THIS, argumentPtr);
+}
+
 EmwOsInterface::Status EmwOsInterface::CreateMutex(EmwOsInterface::Mutex_t &mutex, const char *mutexNamePtr) noexcept
 {
   EmwOsInterface::Status status;
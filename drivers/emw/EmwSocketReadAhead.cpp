@@ -0,0 +1,270 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "emw_conf.hpp"
+#include "EmwSocketReadAhead.hpp"
+#include "EmwApiEmw.hpp"
+#include <cinttypes>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(EMW_API_DEBUG)
+#define DEBUG_API_LOG(...)
+#endif /* EMW_API_DEBUG */
+
+
+EmwSocketReadAhead::EmwSocketReadAhead(EmwApiEmw &emw, std::int32_t socketFd, std::uint32_t depth) noexcept
+  : emw(emw)
+  , socketFd(socketFd)
+  , ringPtr(nullptr)
+  , ringSize(0U)
+  , chunkSize(EmwApiEmw::SocketReceiveSizeMax())
+  , readIndex(0U)
+  , writeIndex(0U)
+  , level(0U)
+  , requestBudget(UINT32_MAX)
+  , receiveStatus(1)
+#if defined(EMW_WITH_RTOS)
+  , ringLock()
+  , dataSem()
+  , spaceSem()
+  , fillerThread()
+  , fillerQuitFlag(false)
+  , fillerRunning(false)
+#endif /* EMW_WITH_RTOS */
+{
+  DEBUG_API_LOG("\n EmwSocketReadAhead::EmwSocketReadAhead()> %" PRIi32 ", depth %" PRIu32 "\n", socketFd, depth)
+
+  if ((0 <= socketFd) && (0U != depth)) {
+    this->ringSize = this->chunkSize * depth;
+    this->ringPtr = static_cast<std::uint8_t *>(EmwOsInterface::Malloc(this->ringSize));
+  }
+#if defined(EMW_WITH_RTOS)
+  if (nullptr != this->ringPtr) {
+    static const char ring_lock_name[] = {"EMW-ReadAheadLock"};
+    static const char data_sem_name[] = {"EMW-ReadAheadDataSem"};
+    static const char space_sem_name[] = {"EMW-ReadAheadSpaceSem"};
+    static const char filler_thread_name[] = {"EMW-ReadAheadThread"};
+
+    EmwOsInterface::AssertAlways(EmwOsInterface::eOK == EmwOsInterface::CreateMutex(this->ringLock, ring_lock_name));
+    EmwOsInterface::AssertAlways(EmwOsInterface::eOK \
+                                 == EmwOsInterface::CreateSemaphore(this->dataSem, data_sem_name, 1U, 0U));
+    EmwOsInterface::AssertAlways(EmwOsInterface::eOK \
+                                 == EmwOsInterface::CreateSemaphore(this->spaceSem, space_sem_name, 1U, 0U));
+    this->fillerRunning = true;
+    if (EmwOsInterface::eOK != EmwOsInterface::CreateThread(this->fillerThread, filler_thread_name,
+        EmwSocketReadAhead::FillerThreadFunction, this,
+        EMW_SOCKET_READ_AHEAD_THREAD_STACK_SIZE, EMW_SOCKET_READ_AHEAD_THREAD_PRIORITY)) {
+      this->fillerRunning = false;
+      (void) EmwOsInterface::DeleteSemaphore(this->spaceSem);
+      (void) EmwOsInterface::DeleteSemaphore(this->dataSem);
+      (void) EmwOsInterface::DeleteMutex(this->ringLock);
+      EmwOsInterface::Free(this->ringPtr);
+      this->ringPtr = nullptr;
+    }
+  }
+#endif /* EMW_WITH_RTOS */
+  DEBUG_API_LOG(" EmwSocketReadAhead::EmwSocketReadAhead()< %p\n\n", this->ringPtr)
+}
+
+EmwSocketReadAhead::~EmwSocketReadAhead(void) noexcept
+{
+  DEBUG_API_LOG("\n EmwSocketReadAhead::~EmwSocketReadAhead()>\n")
+
+  if (nullptr != this->ringPtr) {
+#if defined(EMW_WITH_RTOS)
+    /* A receive in progress is not interrupted, it ends with data or with the socket time out. */
+    this->fillerQuitFlag = true;
+    (void) EmwOsInterface::ReleaseSemaphore(this->spaceSem);
+    while (this->fillerRunning) {
+      EmwOsInterface::DelayTicks(1U);
+    }
+    EmwOsInterface::TerminateThread(this->fillerThread);
+    (void) EmwOsInterface::DeleteSemaphore(this->spaceSem);
+    (void) EmwOsInterface::DeleteSemaphore(this->dataSem);
+    (void) EmwOsInterface::DeleteMutex(this->ringLock);
+#endif /* EMW_WITH_RTOS */
+    EmwOsInterface::Free(this->ringPtr);
+    this->ringPtr = nullptr;
+  }
+  DEBUG_API_LOG(" EmwSocketReadAhead::~EmwSocketReadAhead()<\n\n")
+}
+
+std::int32_t EmwSocketReadAhead::receive(std::uint8_t (&buffer)[], std::int32_t bufferLength) noexcept
+{
+  std::int32_t status = -4;
+
+  if ((nullptr != this->ringPtr) && (0 < bufferLength)) {
+    for (;;) {
+      bool is_empty = false;
+      {
+#if defined(EMW_WITH_RTOS)
+        EmwScopedLock lock(this->ringLock);
+#endif /* EMW_WITH_RTOS */
+
+        if (0U != this->level) {
+          const std::size_t level_to_read = this->level;
+          const std::size_t length = (static_cast<std::size_t>(bufferLength) < level_to_read) \
+                                     ? static_cast<std::size_t>(bufferLength) : level_to_read;
+          const std::size_t first_length = ((this->ringSize - this->readIndex) < length) \
+                                           ? (this->ringSize - this->readIndex) : length;
+
+          (void) EMW_MEMCPY(&buffer[0], &this->ringPtr[this->readIndex], first_length);
+          if (first_length < length) {
+            (void) EMW_MEMCPY(&buffer[first_length], &this->ringPtr[0], length - first_length);
+          }
+          this->readIndex = (this->readIndex + length) % this->ringSize;
+          this->level = level_to_read - length;
+          status = static_cast<std::int32_t>(length);
+        }
+        else if (0U == this->requestBudget) {
+          status = 0;
+        }
+        else if (0 >= this->receiveStatus) {
+          status = this->receiveStatus;
+        }
+        else {
+          is_empty = true;
+        }
+      }
+      if (!is_empty) {
+        break;
+      }
+#if defined(EMW_WITH_RTOS)
+      (void) EmwOsInterface::TakeSemaphore(this->dataSem, EMW_OS_TIMEOUT_FOREVER);
+#else
+      (void) this->fill();
+#endif /* EMW_WITH_RTOS */
+    }
+#if defined(EMW_WITH_RTOS)
+    if (0 < status) {
+      (void) EmwOsInterface::ReleaseSemaphore(this->spaceSem);
+    }
+#endif /* EMW_WITH_RTOS */
+  }
+  return status;
+}
+
+void EmwSocketReadAhead::setReadLimit(std::uint32_t length) noexcept
+{
+  if (nullptr != this->ringPtr) {
+    {
+#if defined(EMW_WITH_RTOS)
+      EmwScopedLock lock(this->ringLock);
+#endif /* EMW_WITH_RTOS */
+      const std::size_t level_to_read = this->level;
+
+      /* The data already in the ring are part of the limit. */
+      this->requestBudget = (length > level_to_read) ? static_cast<std::uint32_t>(length - level_to_read) : 0U;
+    }
+#if defined(EMW_WITH_RTOS)
+    (void) EmwOsInterface::ReleaseSemaphore(this->spaceSem);
+#endif /* EMW_WITH_RTOS */
+  }
+}
+
+/* Receives once into the free contiguous part of the ring, only the filler updates the write index.
+ * Returns 0 without receiving when the read limit is reached, the receive status is then left unchanged.
+ */
+std::int32_t EmwSocketReadAhead::fill(void) noexcept
+{
+  std::size_t length;
+  std::int32_t received = 0;
+
+  {
+#if defined(EMW_WITH_RTOS)
+    EmwScopedLock lock(this->ringLock);
+#endif /* EMW_WITH_RTOS */
+
+    /* Restarts from the beginning of an empty ring to get the largest contiguous free part. */
+    if (0U == this->level) {
+      this->readIndex = 0U;
+      this->writeIndex = 0U;
+    }
+    length = this->ringSize - this->level;
+    if ((this->ringSize - this->writeIndex) < length) {
+      length = this->ringSize - this->writeIndex;
+    }
+    if (this->chunkSize < length) {
+      length = this->chunkSize;
+    }
+    if (this->requestBudget < length) {
+      length = this->requestBudget;
+    }
+  }
+  if (0U != length) {
+    received = this->emw.socketReceive(this->socketFd,
+                                       reinterpret_cast<std::uint8_t (&)[]>(this->ringPtr[this->writeIndex]),
+                                       static_cast<std::int32_t>(length), 0);
+#if defined(EMW_WITH_RTOS)
+    EmwScopedLock lock(this->ringLock);
+#endif /* EMW_WITH_RTOS */
+
+    if (0 < received) {
+      this->writeIndex = (this->writeIndex + static_cast<std::size_t>(received)) % this->ringSize;
+      this->level = this->level + static_cast<std::size_t>(received);
+      /* The limit may have been lowered while receiving. */
+      this->requestBudget = (this->requestBudget > static_cast<std::uint32_t>(received)) \
+                            ? (this->requestBudget - static_cast<std::uint32_t>(received)) : 0U;
+    }
+    else {
+      this->receiveStatus = received;
+    }
+  }
+  return received;
+}
+
+std::size_t EmwSocketReadAhead::getLevel(void) noexcept
+{
+#if defined(EMW_WITH_RTOS)
+  EmwScopedLock lock(this->ringLock);
+#endif /* EMW_WITH_RTOS */
+
+  return this->level;
+}
+
+#if defined(EMW_WITH_RTOS)
+void EmwSocketReadAhead::FillerThreadFunction(EmwOsInterface::ThreadFunctionArgument_t argumentPtr) noexcept
+{
+  EmwSocketReadAhead * const THIS = static_cast<EmwSocketReadAhead *>(const_cast<void *>(argumentPtr));
+
+  while (!THIS->fillerQuitFlag) {
+    const std::size_t free_size = THIS->ringSize - THIS->getLevel();
+
+    /* Waits for a whole chunk of free space, so that the receive requests stay as large as possible. */
+    if (free_size < THIS->chunkSize) {
+      (void) EmwOsInterface::TakeSemaphore(THIS->spaceSem, EMW_OS_TIMEOUT_FOREVER);
+      continue;
+    }
+    {
+      const std::int32_t received = THIS->fill();
+
+      (void) EmwOsInterface::ReleaseSemaphore(THIS->dataSem);
+      if (0 >= THIS->receiveStatus) {
+        break;
+      }
+      /* The read limit is reached, waits for the next one. */
+      if (0 == received) {
+        (void) EmwOsInterface::TakeSemaphore(THIS->spaceSem, EMW_OS_TIMEOUT_FOREVER);
+      }
+    }
+  }
+  THIS->fillerRunning = false;
+  EmwOsInterface::ExitThread();
+}
+#endif /* EMW_WITH_RTOS */
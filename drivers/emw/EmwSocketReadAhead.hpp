@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "emw_conf.hpp"
+#include "EmwOsInterface.hpp"
+#include <cstddef>
+#include <cstdint>
+
+class EmwApiEmw;
+
+/* Read-ahead ring in front of EmwApiEmw::socketReceive() for one connected socket.
+ * The ring holds 'depth' chunks of the largest receive carried by one IPC response.
+ * With an RTOS, a filler thread requests the next chunks while the application consumes the previous ones.
+ * Without RTOS, the ring is refilled on demand and only the small reads are served locally.
+ * The object must be destroyed before closing the socket.
+ */
+class EmwSocketReadAhead final {
+  public:
+    explicit EmwSocketReadAhead(EmwApiEmw &emw, std::int32_t socketFd,
+                                std::uint32_t depth = EMW_SOCKET_READ_AHEAD_DEPTH) noexcept;
+  public:
+    explicit EmwSocketReadAhead(const EmwSocketReadAhead &other) = delete;
+  public:
+    ~EmwSocketReadAhead(void) noexcept;
+  public:
+    bool isValid(void) const noexcept
+    {
+      return (nullptr != this->ringPtr);
+    }
+  public:
+    std::int32_t receive(std::uint8_t (&buffer)[], std::int32_t bufferLength) noexcept;
+  public:
+    void setReadLimit(std::uint32_t length) noexcept;
+
+  private:
+    std::int32_t fill(void) noexcept;
+  private:
+    std::size_t getLevel(void) noexcept;
+#if defined(EMW_WITH_RTOS)
+  private:
+    static void FillerThreadFunction(EmwOsInterface::ThreadFunctionArgument_t argumentPtr) noexcept;
+#endif /* EMW_WITH_RTOS */
+
+  private:
+    EmwApiEmw &emw;
+  private:
+    const std::int32_t socketFd;
+  private:
+    std::uint8_t *ringPtr;
+  private:
+    std::size_t ringSize;
+  private:
+    std::size_t chunkSize;
+  private:
+    std::size_t readIndex;
+  private:
+    std::size_t writeIndex;
+  private:
+    volatile std::size_t level;
+  private:
+    volatile std::uint32_t requestBudget;
+  private:
+    volatile std::int32_t receiveStatus;
+#if defined(EMW_WITH_RTOS)
+  private:
+    EmwOsInterface::Mutex_t ringLock;
+  private:
+    EmwOsInterface::Semaphore_t dataSem;
+  private:
+    EmwOsInterface::Semaphore_t spaceSem;
+  private:
+    EmwOsInterface::Thread_t fillerThread;
+  private:
+    volatile bool fillerQuitFlag;
+  private:
+    volatile bool fillerRunning;
+#endif /* EMW_WITH_RTOS */
+};
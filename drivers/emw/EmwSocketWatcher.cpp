@@ -0,0 +1,304 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "emw_conf.hpp"
+#include "EmwSocketWatcher.hpp"
+#include "EmwAddress.hpp"
+#include "EmwApiEmw.hpp"
+#include "stm32u5xx_hal.h"
+#include <cinttypes>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(EMW_API_DEBUG)
+#define DEBUG_API_LOG(...)
+#endif /* EMW_API_DEBUG */
+
+
+EmwSocketWatcher::EmwSocketWatcher(EmwApiEmw &emw) noexcept
+  : emw(emw)
+#if defined(EMW_WITH_RTOS)
+  , slots()
+  , slotsLock()
+  , workSem()
+  , watcherThread()
+  , isStarting(false)
+  , isStarted(false)
+  , watcherQuitFlag(false)
+  , watcherRunning(false)
+#endif /* EMW_WITH_RTOS */
+{
+}
+
+EmwSocketWatcher::~EmwSocketWatcher(void) noexcept
+{
+#if defined(EMW_WITH_RTOS)
+  if (this->isStarted) {
+    this->watcherQuitFlag = true;
+    (void) EmwOsInterface::ReleaseSemaphore(this->workSem);
+    while (this->watcherRunning) {
+      EmwOsInterface::DelayTicks(1U);
+    }
+    EmwOsInterface::TerminateThread(this->watcherThread);
+    for (EmwSocketWatcher::Slot_t &slot : this->slots) {
+      (void) EmwOsInterface::DeleteSemaphore(slot.sem);
+    }
+    (void) EmwOsInterface::DeleteSemaphore(this->workSem);
+    (void) EmwOsInterface::DeleteMutex(this->slotsLock);
+  }
+#endif /* EMW_WITH_RTOS */
+}
+
+std::int32_t EmwSocketWatcher::waitReady(std::int32_t socketFd, std::uint32_t events,
+    std::uint32_t timeoutInMs) noexcept
+{
+  std::int32_t status = -1;
+
+  DEBUG_API_LOG("\n EmwSocketWatcher::waitReady()> %" PRIi32 ", 0x%02" PRIx32 "\n", socketFd, events)
+
+  if ((0 <= socketFd) && (static_cast<std::uint32_t>(socketFd) < EMW_FD_SETSIZE) && (0U != events)) {
+#if defined(EMW_WITH_RTOS)
+    EmwSocketWatcher::Slot_t *slot_ptr = nullptr;
+
+    this->start();
+    {
+      EmwScopedLock lock(this->slotsLock);
+
+      for (EmwSocketWatcher::Slot_t &slot : this->slots) {
+        if (!slot.isUsed) {
+          slot.socketFd = socketFd;
+          slot.events = events;
+          slot.readyEvents = 0U;
+          slot.status = 0;
+          slot.isUsed = true;
+          slot.isPending = true;
+          slot_ptr = &slot;
+          break;
+        }
+      }
+    }
+    if (nullptr == slot_ptr) {
+      /* All the slots are busy, this waiter polls by itself without holding the IPC for its whole time out. */
+      status = this->pollReady(socketFd, events, timeoutInMs);
+    }
+    else {
+      (void) EmwOsInterface::ReleaseSemaphore(this->workSem);
+      (void) EmwOsInterface::TakeSemaphore(slot_ptr->sem, timeoutInMs);
+      {
+        EmwScopedLock lock(this->slotsLock);
+
+        status = (0 > slot_ptr->status) ? -1 : static_cast<std::int32_t>(slot_ptr->readyEvents);
+        slot_ptr->isPending = false;
+        slot_ptr->isUsed = false;
+      }
+      /* Drops a wake up given after the time out, the slot is no more pending so no other can come. */
+      (void) EmwOsInterface::TakeSemaphore(slot_ptr->sem, 0U);
+    }
+#else
+    status = this->selectOnce(socketFd, events, timeoutInMs);
+#endif /* EMW_WITH_RTOS */
+  }
+  DEBUG_API_LOG(" EmwSocketWatcher::waitReady()< %" PRIi32 "\n\n", status)
+  return status;
+}
+
+std::int32_t EmwSocketWatcher::selectOnce(std::int32_t socketFd, std::uint32_t events,
+    std::uint32_t timeoutInMs) noexcept
+{
+  std::int32_t status;
+  EmwFdSet_t read_fds;
+  EmwFdSet_t write_fds;
+  EmwFdSet_t except_fds;
+  const EmwTimeVal_t timeout = {
+    static_cast<std::int32_t>(timeoutInMs / 1000U), static_cast<std::int32_t>((timeoutInMs % 1000U) * 1000U)
+  };
+
+  EMW_FD_ZERO(&read_fds);
+  EMW_FD_ZERO(&write_fds);
+  EMW_FD_ZERO(&except_fds);
+  if (0U != (events & EmwSocketWatcher::eREADABLE)) {
+    EMW_FD_SET(socketFd, &read_fds);
+  }
+  if (0U != (events & EmwSocketWatcher::eWRITABLE)) {
+    EMW_FD_SET(socketFd, &write_fds);
+  }
+  if (0U != (events & EmwSocketWatcher::eEXCEPTION)) {
+    EMW_FD_SET(socketFd, &except_fds);
+  }
+  status = this->emw.socketSelect(socketFd + 1, &read_fds, &write_fds, &except_fds, timeout);
+  if (0 < status) {
+    std::uint32_t ready_events = 0U;
+
+    if (EMW_FD_ISSET(socketFd, &read_fds)) {
+      ready_events |= EmwSocketWatcher::eREADABLE;
+    }
+    if (EMW_FD_ISSET(socketFd, &write_fds)) {
+      ready_events |= EmwSocketWatcher::eWRITABLE;
+    }
+    if (EMW_FD_ISSET(socketFd, &except_fds)) {
+      ready_events |= EmwSocketWatcher::eEXCEPTION;
+    }
+    status = static_cast<std::int32_t>(ready_events & events);
+  }
+  else if (0 > status) {
+    status = -1;
+  }
+  return status;
+}
+
+#if defined(EMW_WITH_RTOS)
+std::int32_t EmwSocketWatcher::pollReady(std::int32_t socketFd, std::uint32_t events,
+    std::uint32_t timeoutInMs) noexcept
+{
+  std::int32_t status;
+  const std::uint32_t start_time_in_ms = HAL_GetTick();
+
+  for (;;) {
+    const std::uint32_t elapsed_in_ms = HAL_GetTick() - start_time_in_ms;
+    const std::uint32_t remaining_in_ms = (elapsed_in_ms < timeoutInMs) ? (timeoutInMs - elapsed_in_ms) : 0U;
+
+    status = this->selectOnce(socketFd, events,
+                              (static_cast<std::uint32_t>(EMW_SOCKET_WATCHER_SELECT_TIMEOUT_MS) < remaining_in_ms) \
+                              ? static_cast<std::uint32_t>(EMW_SOCKET_WATCHER_SELECT_TIMEOUT_MS) : remaining_in_ms);
+    if ((0 != status) || (0U == remaining_in_ms)) {
+      break;
+    }
+    EmwOsInterface::Delay((EMW_SOCKET_WATCHER_PERIOD_MS < remaining_in_ms) \
+                          ? EMW_SOCKET_WATCHER_PERIOD_MS : remaining_in_ms);
+  }
+  return status;
+}
+
+void EmwSocketWatcher::start(void) noexcept
+{
+  bool must_start;
+
+  EmwOsInterface::Lock();
+  must_start = !this->isStarting;
+  this->isStarting = true;
+  EmwOsInterface::UnLock();
+
+  if (must_start) {
+    static const char slots_lock_name[] = {"EMW-WatcherLock"};
+    static const char work_sem_name[] = {"EMW-WatcherWorkSem"};
+    static const char slot_sem_name[] = {"EMW-WatcherSlotSem"};
+    static const char watcher_thread_name[] = {"EMW-WatcherThread"};
+
+    EmwOsInterface::AssertAlways(EmwOsInterface::eOK == EmwOsInterface::CreateMutex(this->slotsLock, slots_lock_name));
+    EmwOsInterface::AssertAlways(EmwOsInterface::eOK \
+                                 == EmwOsInterface::CreateSemaphore(this->workSem, work_sem_name, 1U, 0U));
+    for (EmwSocketWatcher::Slot_t &slot : this->slots) {
+      EmwOsInterface::AssertAlways(EmwOsInterface::eOK \
+                                   == EmwOsInterface::CreateSemaphore(slot.sem, slot_sem_name, 1U, 0U));
+    }
+    this->watcherRunning = true;
+    EmwOsInterface::AssertAlways(EmwOsInterface::eOK \
+                                 == EmwOsInterface::CreateThread(this->watcherThread, watcher_thread_name,
+                                     EmwSocketWatcher::WatcherThreadFunction, this,
+                                     EMW_SOCKET_WATCHER_THREAD_STACK_SIZE, EMW_SOCKET_WATCHER_THREAD_PRIORITY));
+    this->isStarted = true;
+  }
+  while (!this->isStarted) {
+    EmwOsInterface::DelayTicks(1U);
+  }
+}
+
+void EmwSocketWatcher::watch(void) noexcept
+{
+  while (!this->watcherQuitFlag) {
+    EmwFdSet_t read_fds;
+    EmwFdSet_t write_fds;
+    EmwFdSet_t except_fds;
+    std::int32_t nfds = 0;
+
+    EMW_FD_ZERO(&read_fds);
+    EMW_FD_ZERO(&write_fds);
+    EMW_FD_ZERO(&except_fds);
+    {
+      EmwScopedLock lock(this->slotsLock);
+
+      for (const EmwSocketWatcher::Slot_t &slot : this->slots) {
+        if (slot.isPending) {
+          if (0U != (slot.events & EmwSocketWatcher::eREADABLE)) {
+            EMW_FD_SET(slot.socketFd, &read_fds);
+          }
+          if (0U != (slot.events & EmwSocketWatcher::eWRITABLE)) {
+            EMW_FD_SET(slot.socketFd, &write_fds);
+          }
+          if (0U != (slot.events & EmwSocketWatcher::eEXCEPTION)) {
+            EMW_FD_SET(slot.socketFd, &except_fds);
+          }
+          if (nfds <= slot.socketFd) {
+            nfds = slot.socketFd + 1;
+          }
+        }
+      }
+    }
+    if (0 == nfds) {
+      (void) EmwOsInterface::TakeSemaphore(this->workSem, EMW_OS_TIMEOUT_FOREVER);
+      continue;
+    }
+    {
+      const EmwTimeVal_t timeout = {
+        EMW_SOCKET_WATCHER_SELECT_TIMEOUT_MS / 1000, (EMW_SOCKET_WATCHER_SELECT_TIMEOUT_MS % 1000) * 1000
+      };
+      const std::int32_t status = this->emw.socketSelect(nfds, &read_fds, &write_fds, &except_fds, timeout);
+
+      if (0 != status) {
+        EmwScopedLock lock(this->slotsLock);
+
+        for (EmwSocketWatcher::Slot_t &slot : this->slots) {
+          if (slot.isPending) {
+            std::uint32_t ready_events = 0U;
+
+            if (0 < status) {
+              if (EMW_FD_ISSET(slot.socketFd, &read_fds)) {
+                ready_events |= EmwSocketWatcher::eREADABLE;
+              }
+              if (EMW_FD_ISSET(slot.socketFd, &write_fds)) {
+                ready_events |= EmwSocketWatcher::eWRITABLE;
+              }
+              if (EMW_FD_ISSET(slot.socketFd, &except_fds)) {
+                ready_events |= EmwSocketWatcher::eEXCEPTION;
+              }
+              ready_events &= slot.events;
+            }
+            if ((0U != ready_events) || (0 > status)) {
+              slot.readyEvents = ready_events;
+              slot.status = status;
+              slot.isPending = false;
+              (void) EmwOsInterface::ReleaseSemaphore(slot.sem);
+            }
+          }
+        }
+      }
+    }
+    /* Lets the other users of the IPC in between two polls. */
+    EmwOsInterface::Delay(EMW_SOCKET_WATCHER_PERIOD_MS);
+  }
+}
+
+void EmwSocketWatcher::WatcherThreadFunction(EmwOsInterface::ThreadFunctionArgument_t argumentPtr) noexcept
+{
+  EmwSocketWatcher * const THIS = static_cast<EmwSocketWatcher *>(const_cast<void *>(argumentPtr));
+
+  THIS->watch();
+  THIS->watcherRunning = false;
+  EmwOsInterface::ExitThread();
+}
+#endif /* EMW_WITH_RTOS */
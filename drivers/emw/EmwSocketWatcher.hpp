@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "emw_conf.hpp"
+#include "EmwOsInterface.hpp"
+#include <cstdint>
+
+class EmwApiEmw;
+
+/* Readiness of the sockets offloaded to the EMW module.
+ * The module has no socket event, so with an RTOS a single watcher thread polls all the waited sockets
+ * with one select request per period, and wakes up the waiters. When all the slots are busy, the waiter polls
+ * by itself at the same pace.
+ * Without RTOS, the waiter itself blocks in one select request.
+ */
+class EmwSocketWatcher final {
+  public:
+    enum /*class*/ Event : std::uint32_t {
+      eREADABLE = 0x01U,
+      eWRITABLE = 0x02U,
+      eEXCEPTION = 0x04U
+    };
+
+  public:
+    explicit EmwSocketWatcher(EmwApiEmw &emw) noexcept;
+  public:
+    explicit EmwSocketWatcher(const EmwSocketWatcher &other) = delete;
+  public:
+    ~EmwSocketWatcher(void) noexcept;
+  public:
+    /* Returns the mask of the events ready, 0 on time out, -1 on error. */
+    std::int32_t waitReady(std::int32_t socketFd, std::uint32_t events, std::uint32_t timeoutInMs) noexcept;
+
+  private:
+    std::int32_t selectOnce(std::int32_t socketFd, std::uint32_t events, std::uint32_t timeoutInMs) noexcept;
+#if defined(EMW_WITH_RTOS)
+  private:
+    std::int32_t pollReady(std::int32_t socketFd, std::uint32_t events, std::uint32_t timeoutInMs) noexcept;
+  private:
+    void start(void) noexcept;
+  private:
+    void watch(void) noexcept;
+  private:
+    static void WatcherThreadFunction(EmwOsInterface::ThreadFunctionArgument_t argumentPtr) noexcept;
+#endif /* EMW_WITH_RTOS */
+
+#if defined(EMW_WITH_RTOS)
+  private:
+    typedef struct Slot_s {
+      std::int32_t socketFd;
+      std::uint32_t events;
+      std::uint32_t readyEvents;
+      std::int32_t status;
+      bool isUsed;
+      bool isPending;
+      EmwOsInterface::Semaphore_t sem;
+    } Slot_t;
+#endif /* EMW_WITH_RTOS */
+
+  private:
+    EmwApiEmw &emw;
+#if defined(EMW_WITH_RTOS)
+  private:
+    EmwSocketWatcher::Slot_t slots[EMW_SOCKET_WATCHER_SLOT_COUNT];
+  private:
+    EmwOsInterface::Mutex_t slotsLock;
+  private:
+    EmwOsInterface::Semaphore_t workSem;
+  private:
+    EmwOsInterface::Thread_t watcherThread;
+  private:
+    bool isStarting;
+  private:
+    volatile bool isStarted;
+  private:
+    volatile bool watcherQuitFlag;
+  private:
+    volatile bool watcherRunning;
+#endif /* EMW_WITH_RTOS */
+};
@@ -0,0 +1,175 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "emw_conf.hpp"
+#include "EmwOsInterface.hpp"
+#include <atomic>
+#include <cstdint>
+
+/* Ring of element pointers for exactly one producer thread and one consumer thread.
+ * Each index is only written by its own side, so putting and getting need no critical section.
+ * A side that finds the ring empty (or full) flags itself as sleeping and waits on its semaphore,
+ * the other side only releases that semaphore when it sees the flag.
+ * Without RTOS the producer runs in the wait hook of the consumer, a full ring is never waited.
+ */
+template <typename T, std::uint32_t SIZE>
+class EmwSpscRing final {
+    static_assert((0U != SIZE) && (0U == (SIZE & (SIZE - 1U))), "The size must be a power of 2.");
+
+  public:
+    typedef struct Statistics_s {
+      constexpr Statistics_s(void) noexcept
+        : consumerWakeUps(0U), producerWakeUps(0U) {}
+      std::uint32_t consumerWakeUps;
+      std::uint32_t producerWakeUps;
+    } Statistics_t;
+
+  public:
+    constexpr EmwSpscRing(void) noexcept
+      : slots(), writeIndex(0U), readIndex(0U), isConsumerSleeping(false), isProducerSleeping(false)
+      , dataSem(), spaceSem(), statistics() {}
+  public:
+    explicit EmwSpscRing(const EmwSpscRing &other) = delete;
+
+  public:
+    EmwOsInterface::Status initialize(const char *dataSemNamePtr, const char *spaceSemNamePtr) noexcept
+    {
+      EmwOsInterface::Status status;
+
+      this->writeIndex.store(0U, std::memory_order_relaxed);
+      this->readIndex.store(0U, std::memory_order_relaxed);
+      this->isConsumerSleeping.store(false, std::memory_order_relaxed);
+      this->isProducerSleeping.store(false, std::memory_order_relaxed);
+      this->statistics = EmwSpscRing::Statistics_t();
+      status = EmwOsInterface::CreateSemaphore(this->dataSem, dataSemNamePtr, 1U, 0U);
+      if (EmwOsInterface::eOK == status) {
+        status = EmwOsInterface::CreateSemaphore(this->spaceSem, spaceSemNamePtr, 1U, 0U);
+        if (EmwOsInterface::eOK != status) {
+          EmwOsInterface::DeleteSemaphore(this->dataSem);
+        }
+      }
+      return status;
+    }
+
+  public:
+    void unInitialize(void) noexcept
+    {
+      EmwOsInterface::DeleteSemaphore(this->spaceSem);
+      EmwOsInterface::DeleteSemaphore(this->dataSem);
+    }
+
+#if defined(EMW_WITH_NO_OS)
+  public:
+    /* The hook is run while the consumer waits, it is the producer. */
+    EmwOsInterface::Status addConsumerHook(EmwOsInterface::RunnerHook_t waiter, void *THIS,
+                                           const void *argumentPtr) noexcept
+    {
+      return EmwOsInterface::AddSemaphoreHook(this->dataSem, waiter, THIS, argumentPtr);
+    }
+#endif /* EMW_WITH_NO_OS */
+
+  public:
+    /* Returns false when the ring is still full at the time out. */
+    bool put(T *elementPtr, std::uint32_t timeoutInMs) noexcept
+    {
+      const std::uint32_t write_index = this->writeIndex.load(std::memory_order_relaxed);
+      bool is_waited = false;
+
+      while ((write_index - this->readIndex.load(std::memory_order_acquire)) == SIZE) {
+#if defined(EMW_WITH_RTOS)
+        if ((0U == timeoutInMs) || (is_waited && (EMW_OS_TIMEOUT_FOREVER != timeoutInMs))) {
+          return false;
+        }
+        this->isProducerSleeping.store(true, std::memory_order_seq_cst);
+        if ((write_index - this->readIndex.load(std::memory_order_seq_cst)) == SIZE) {
+          (void) EmwOsInterface::TakeSemaphore(this->spaceSem, timeoutInMs);
+          is_waited = true;
+        }
+        this->isProducerSleeping.store(false, std::memory_order_relaxed);
+#else
+        static_cast<void>(timeoutInMs);
+        static_cast<void>(is_waited);
+        return false;
+#endif /* EMW_WITH_RTOS */
+      }
+      this->slots[write_index % SIZE] = elementPtr;
+      this->writeIndex.store(write_index + 1U, std::memory_order_seq_cst);
+      if (this->isConsumerSleeping.load(std::memory_order_seq_cst)) {
+        this->isConsumerSleeping.store(false, std::memory_order_relaxed);
+        this->statistics.consumerWakeUps++;
+        (void) EmwOsInterface::ReleaseSemaphore(this->dataSem);
+      }
+      return true;
+    }
+
+  public:
+    /* Returns nullptr when the ring is still empty at the time out.
+     * A wake up left over from a previous wait may end a finite wait early.
+     */
+    T *get(std::uint32_t timeoutInMs) noexcept
+    {
+      const std::uint32_t read_index = this->readIndex.load(std::memory_order_relaxed);
+      bool is_waited = false;
+      T *element_ptr;
+
+      while (read_index == this->writeIndex.load(std::memory_order_acquire)) {
+        if ((0U == timeoutInMs) || (is_waited && (EMW_OS_TIMEOUT_FOREVER != timeoutInMs))) {
+          return nullptr;
+        }
+        this->isConsumerSleeping.store(true, std::memory_order_seq_cst);
+        if (read_index == this->writeIndex.load(std::memory_order_seq_cst)) {
+          (void) EmwOsInterface::TakeSemaphore(this->dataSem, timeoutInMs);
+          is_waited = true;
+        }
+        this->isConsumerSleeping.store(false, std::memory_order_relaxed);
+      }
+      element_ptr = this->slots[read_index % SIZE];
+      this->readIndex.store(read_index + 1U, std::memory_order_seq_cst);
+      if (this->isProducerSleeping.load(std::memory_order_seq_cst)) {
+        this->isProducerSleeping.store(false, std::memory_order_relaxed);
+        this->statistics.producerWakeUps++;
+        (void) EmwOsInterface::ReleaseSemaphore(this->spaceSem);
+      }
+      return element_ptr;
+    }
+
+  public:
+    void getStatistics(EmwSpscRing::Statistics_t &statistics) const noexcept
+    {
+      statistics = this->statistics;
+    }
+
+  private:
+    T *slots[SIZE];
+  private:
+    std::atomic<std::uint32_t> writeIndex;
+  private:
+    std::atomic<std::uint32_t> readIndex;
+  private:
+    std::atomic<bool> isConsumerSleeping;
+  private:
+    std::atomic<bool> isProducerSleeping;
+  private:
+    EmwOsInterface::Semaphore_t dataSem;
+  private:
+    EmwOsInterface::Semaphore_t spaceSem;
+  private:
+    EmwSpscRing::Statistics_t statistics;
+};
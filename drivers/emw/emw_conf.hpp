@@ -13,6 +13,7 @@
 #endif /* __cplusplus */
 
 #include "stm32u5xx_hal.h"
+#include "memcopy.h"
 
 /* #define EMW_API_DEBUG */
 /* #define EMW_IPC_DEBUG */
@@ -49,23 +50,69 @@
 
 #define EMW_CMD_TIMEOUT                         (10000U)
 
+/* The driver threads, semaphores, mutexes and queues take the memory of their owner instead of the heap,
+ * when the RTOS supports it (configSUPPORT_STATIC_ALLOCATION).
+ */
+#define EMW_OS_STATIC_ALLOCATION
+
+/* Indexes of the driver notifications in the notification array of the threads, 0 is left to the applications. */
+#define EMW_OS_NOTIFICATION_IPC_RESPONSE        (1U)
+#define EMW_OS_NOTIFICATION_SPI_TXRX            (2U)
+#define EMW_OS_NOTIFICATION_SPI_FLOW_RISE       (3U)
+#define EMW_OS_NOTIFICATION_SPI_TRANSFER_DONE   (4U)
+
 #define EMW_IO_SPI_THREAD_PRIORITY              (31)
 #define EMW_IO_SPI_THREAD_STACK_SIZE            (360U + 240U)
 
+/* Attempts to allocate a receive buffer inside the SPI transaction, one tick apart with an RTOS.
+ * The payload is clocked into a scratch buffer and dropped beyond. */
+#define EMW_IO_SPI_RX_ALLOC_ATTEMPT_COUNT       (4U)
+#define EMW_IO_SPI_RX_SCRATCH_SIZE              (64U)
+
 #define EMW_RECEIVED_THREAD_PRIORITY            (18)
 #define EMW_RECEIVED_THREAD_STACK_SIZE          (360U + 384U)
 
 #define EMW_HCI_MAX_RX_BUFFER_COUNT             (4U)
 
+/* Received frames up to this size do not take a full size network buffer. */
+#define EMW_NETWORK_SMALL_BUFFER_SIZE           (256U)
+
+/* Blocks of the network buffers pools in EMW mode, the heap is used beyond. */
+#define EMW_NETWORK_BUFFER_POOL_COUNT           (6U)
+#define EMW_NETWORK_SMALL_BUFFER_POOL_COUNT     (8U)
+
+/* Copy of the payloads between the buffers of the application and the ones of the IPC. */
+#define EMW_MEMCPY(DST, SRC, LEN)               MemoryCopy((DST), (SRC), (LEN))
+
+/* Commands sent without waiting for their response, 0 sends them as usual requests. */
+#define EMW_IPC_POST_WINDOW_SIZE                (4U)
+
+#define EMW_DNS_CACHE_ENTRY_COUNT               (4U)
+#define EMW_DNS_CACHE_NAME_SIZE                 (64U)
+#define EMW_DNS_CACHE_TTL_MS                    (300000U)
+#define EMW_DNS_CACHE_NEGATIVE_TTL_MS           (10000U)
+
+#define EMW_SOCKET_READ_AHEAD_DEPTH             (2U)
+#define EMW_SOCKET_READ_AHEAD_THREAD_PRIORITY   (17)
+#define EMW_SOCKET_READ_AHEAD_THREAD_STACK_SIZE (360U + 128U)
+
+#define EMW_SOCKET_WATCHER_SLOT_COUNT           (4U)
+#define EMW_SOCKET_WATCHER_PERIOD_MS            (250U)
+#define EMW_SOCKET_WATCHER_SELECT_TIMEOUT_MS    (0)
+#define EMW_SOCKET_WATCHER_THREAD_PRIORITY      (15)
+#define EMW_SOCKET_WATCHER_THREAD_STACK_SIZE    (360U + 128U)
+
 #define EMW_STATS_ON                            (1)
 
 #if (defined(EMW_STATS_ON) && (EMW_STATS_ON == 1))
 #ifdef __cplusplus
 typedef struct EmwStatistics_s {
   constexpr EmwStatistics_s(void)
-    : alloc(0U), free(0U), cmdGetAnswer(0U), callback(0U), fifoIn(0U), fifoOut(0U) {}
+    : alloc(0U), allocSmall(0U), free(0U), rxDropped(0U), cmdGetAnswer(0U), callback(0U), fifoIn(0U), fifoOut(0U) {}
   std::uint32_t alloc;
+  std::uint32_t allocSmall;
   std::uint32_t free;
+  std::uint32_t rxDropped;
   std::uint32_t cmdGetAnswer;
   std::uint32_t callback;
   std::uint32_t fifoIn;
@@ -80,7 +127,11 @@ extern EmwStatistics_t EmwStats;
 #define EMW_STATS_LOG()                                                                      \
   (void)std::printf("\n Number of allocated buffer for Rx and command answer %" PRIu32 "\n", \
                     EmwStats.alloc);                                                         \
+  (void)std::printf(" Number of allocated buffer from the small size class %" PRIu32 "\n",  \
+                    EmwStats.allocSmall);                                                    \
   (void)std::printf(" Number of freed buffer %" PRIu32 "\n", EmwStats.free);                 \
+  (void)std::printf(" Number of Rx dropped for lack of buffer %" PRIu32 "\n",               \
+                    EmwStats.rxDropped);                                                     \
   (void)std::printf(" Number of command answer %" PRIu32 ", callback %" PRIu32 ","           \
                     " sum of both %" PRIu32 " (must match alloc && free)\n",                 \
                     EmwStats.cmdGetAnswer, EmwStats.callback,                                \
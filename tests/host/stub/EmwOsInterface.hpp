@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include "emw_conf.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+/* Host stand-in of the OS interface of the driver, only the counting semaphores are provided, on the C++ threads.
+ * The semaphores behave like the FreeRTOS ones: the count never exceeds the maximum given at the creation.
+ */
+#define EMW_WITH_RTOS
+#define RTOS_NAME_STRING "Host"
+#define EMW_OS_TIMEOUT_FOREVER UINT32_MAX
+
+class EmwOsInterface final {
+  private:
+    EmwOsInterface(void) {};
+
+  public:
+    enum /*class*/ Status {
+      eOK = 0x00U,
+      eERROR = 0x01U
+    };
+
+  public:
+    typedef struct Semaphore_s {
+      Semaphore_s(void) noexcept
+        : mutex(), condition(), count(0U), maxCount(0U) {}
+      std::mutex mutex;
+      std::condition_variable condition;
+      std::uint32_t count;
+      std::uint32_t maxCount;
+    } Semaphore_t;
+
+  public:
+    static Status CreateSemaphore(EmwOsInterface::Semaphore_t &semaphore, const char *semaphoreNamePtr,
+                                  std::uint32_t max_count, std::uint32_t initial_count) noexcept
+    {
+      static_cast<void>(semaphoreNamePtr);
+      semaphore.maxCount = max_count;
+      semaphore.count = initial_count;
+      return EmwOsInterface::eOK;
+    }
+  public:
+    static Status TakeSemaphore(EmwOsInterface::Semaphore_t &semaphore, std::uint32_t timeoutInMs) noexcept
+    {
+      Status status = EmwOsInterface::eOK;
+      std::unique_lock<std::mutex> lock(semaphore.mutex);
+
+      if (EMW_OS_TIMEOUT_FOREVER == timeoutInMs) {
+        semaphore.condition.wait(lock, [&semaphore] { return 0U != semaphore.count; });
+      }
+      else if (!semaphore.condition.wait_for(lock, std::chrono::milliseconds(timeoutInMs),
+                                             [&semaphore] { return 0U != semaphore.count; })) {
+        status = EmwOsInterface::eERROR;
+      }
+      if (EmwOsInterface::eOK == status) {
+        semaphore.count--;
+      }
+      return status;
+    }
+  public:
+    static Status ReleaseSemaphore(EmwOsInterface::Semaphore_t &semaphore) noexcept
+    {
+      Status status = EmwOsInterface::eERROR;
+      {
+        std::lock_guard<std::mutex> lock(semaphore.mutex);
+
+        if (semaphore.count < semaphore.maxCount) {
+          semaphore.count++;
+          status = EmwOsInterface::eOK;
+        }
+      }
+      semaphore.condition.notify_one();
+      return status;
+    }
+  public:
+    static void DeleteSemaphore(EmwOsInterface::Semaphore_t &semaphore) noexcept
+    {
+      static_cast<void>(semaphore);
+    }
+};
@@ -0,0 +1,27 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#pragma once
+
+#include <cstdint>
+
+/* Host build of LwipChecksum.cpp: only the byte order conversion of lwIP is used, for a little endian host. */
+static inline std::uint16_t lwip_htons(std::uint16_t x)
+{
+  return static_cast<std::uint16_t>(((x & 0xFFU) << 8) | ((x & 0xFF00U) >> 8));
+}
@@ -0,0 +1,159 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "LwipChecksum.hpp"
+#include "lwip/def.h"
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+
+/* Host equivalence test and benchmark of LwipChecksum() against LwipChecksumReference(): every length up to
+ * 4 words beyond the unrolled loop, then random lengths up to a full frame, each at the 8 alignments of the start,
+ * with random bytes and with all ones, that carries the most.
+ */
+#define BUFFER_SIZE 1536U
+#define ALIGNMENT_COUNT 8U
+
+alignas(8) static std::uint8_t Buffer[BUFFER_SIZE + ALIGNMENT_COUNT];
+
+static std::uint32_t NextRandom(std::uint32_t &state)
+{
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+/* The example of RFC 1071 (section 3): the sum of 00 01 f2 03 f4 f5 f6 f7 is ddf2, kept in the memory order. */
+static std::int32_t CheckKnown(void)
+{
+  static const std::uint8_t data[] = {0x00U, 0x01U, 0xF2U, 0x03U, 0xF4U, 0xF5U, 0xF6U, 0xF7U};
+  const std::uint16_t expected = lwip_htons(0xDDF2U);
+  const std::uint16_t reference = LwipChecksumReference(data, static_cast<int>(sizeof(data)));
+  const std::uint16_t checksum = LwipChecksum(data, static_cast<int>(sizeof(data)));
+
+  if ((reference != expected) || (checksum != expected)) {
+    (void) std::printf("known: 0x%04" PRIx32 " and 0x%04" PRIx32 " (reference) instead of 0x%04" PRIx32 "\n",
+                       static_cast<std::uint32_t>(checksum), static_cast<std::uint32_t>(reference),
+                       static_cast<std::uint32_t>(expected));
+    return -1;
+  }
+  return 0;
+}
+
+static std::uint32_t CheckOne(std::uint32_t offset, std::uint32_t length, bool isAllOnes, std::uint32_t &randomState)
+{
+  std::uint8_t *const data_ptr = &Buffer[offset];
+
+  for (std::uint32_t i = 0U; i < length; i++) {
+    data_ptr[i] = isAllOnes ? 0xFFU : static_cast<std::uint8_t>(NextRandom(randomState));
+  }
+  {
+    const std::uint16_t checksum = LwipChecksum(data_ptr, static_cast<int>(length));
+    const std::uint16_t expected = LwipChecksumReference(data_ptr, static_cast<int>(length));
+
+    if (checksum != expected) {
+      (void) std::printf("check: offset %" PRIu32 ", length %" PRIu32 "%s: 0x%04" PRIx32 " instead of 0x%04" PRIx32
+                         "\n", offset, length, isAllOnes ? ", all ones" : "", static_cast<std::uint32_t>(checksum),
+                         static_cast<std::uint32_t>(expected));
+      return 1U;
+    }
+  }
+  return 0U;
+}
+
+static std::int32_t CheckEquivalence(void)
+{
+  std::uint32_t random_state = 0x12345679U;
+  std::uint32_t checks = 0U;
+  std::uint32_t errors = 0U;
+
+  for (std::uint32_t offset = 0U; offset < ALIGNMENT_COUNT; offset++) {
+    for (std::uint32_t length = 0U; length <= 80U; length++) {
+      errors += CheckOne(offset, length, false, random_state);
+      errors += CheckOne(offset, length, true, random_state);
+      checks += 2U;
+    }
+    for (std::uint32_t i = 0U; i < 1000U; i++) {
+      const std::uint32_t length = NextRandom(random_state) % (BUFFER_SIZE + 1U);
+
+      errors += CheckOne(offset, length, (0U == (i % 16U)), random_state);
+      checks++;
+    }
+    errors += CheckOne(offset, BUFFER_SIZE, true, random_state);
+    checks++;
+  }
+  (void) std::printf("chksum: %" PRIu32 " checks, %" PRIu32 " errors\n", checks, errors);
+  return (0U == errors) ? 0 : -1;
+}
+
+/* The time of each function is the lowest of the rounds, so that the scheduling of the host is left out.
+ * It is only reported: the speed of the host says nothing of the one of the target.
+ */
+static void Benchmark(void)
+{
+  static const std::uint32_t sizes[] = {64U, 576U, 1500U};
+  std::uint32_t random_state = 0x2545F491U;
+  std::uint32_t sink = 0U;
+
+  for (std::uint32_t i = 0U; i < BUFFER_SIZE + ALIGNMENT_COUNT; i++) {
+    Buffer[i] = static_cast<std::uint8_t>(NextRandom(random_state));
+  }
+  (void) std::printf("test,size,align,ns_per_byte,ref_ns_per_byte\n");
+  for (const std::uint32_t size : sizes) {
+    for (std::uint32_t offset = 0U; offset < 4U; offset++) {
+      const std::uint32_t loops = 2000U;
+      double best = 1e9;
+      double ref_best = 1e9;
+
+      for (std::uint32_t round = 0U; round < 20U; round++) {
+        auto start = std::chrono::steady_clock::now();
+
+        for (std::uint32_t j = 0U; j < loops; j++) {
+          sink += LwipChecksum(&Buffer[offset + (j & 1U) * 4U], static_cast<int>(size));
+        }
+        auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        best = (elapsed < best) ? elapsed : best;
+
+        start = std::chrono::steady_clock::now();
+        for (std::uint32_t j = 0U; j < loops; j++) {
+          sink += LwipChecksumReference(&Buffer[offset + (j & 1U) * 4U], static_cast<int>(size));
+        }
+        elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        ref_best = (elapsed < ref_best) ? elapsed : ref_best;
+      }
+      (void) std::printf("chksum,%" PRIu32 ",%" PRIu32 ",%.3f,%.3f\n", size, offset,
+                         best / (static_cast<double>(loops) * size), ref_best / (static_cast<double>(loops) * size));
+    }
+  }
+  (void) std::printf("sink: 0x%08" PRIx32 "\n", sink);
+}
+
+int main(void)
+{
+  std::int32_t status = CheckKnown();
+
+  if (0 == status) {
+    status = CheckEquivalence();
+  }
+  if (0 == status) {
+    Benchmark();
+  }
+  return (0 == status) ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * Copyright (C) 2025 C.Fenard.
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program. If not, see <http://www.gnu.org/licenses/>.
+  ******************************************************************************
+  */
+#include "EmwSpscRing.hpp"
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+/* Host stress test of EmwSpscRing: one producer thread and one consumer thread exchange a sequence of numbers,
+ * the consumer checks that none is lost, duplicated or reordered. A small ring keeps both sides going to sleep.
+ */
+typedef EmwSpscRing<std::uint32_t, 4U> Ring_t;
+
+static std::uint32_t *ToElement(std::uint32_t value)
+{
+  return reinterpret_cast<std::uint32_t *>(static_cast<std::uintptr_t>(value));
+}
+
+static std::uint32_t FromElement(const std::uint32_t *elementPtr)
+{
+  return static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(elementPtr));
+}
+
+static std::int32_t CheckLimits(void)
+{
+  static Ring_t ring;
+  std::int32_t status = 0;
+
+  if (EmwOsInterface::eOK != ring.initialize("data", "space")) {
+    return -1;
+  }
+  if (nullptr != ring.get(0U)) {
+    (void) std::printf("limits: get() from an empty ring\n");
+    status = -1;
+  }
+  for (std::uint32_t i = 1U; i <= 4U; i++) {
+    if (!ring.put(ToElement(i), 0U)) {
+      (void) std::printf("limits: put() %" PRIu32 " failed\n", i);
+      status = -1;
+    }
+  }
+  if (ring.put(ToElement(5U), 0U) || ring.put(ToElement(5U), 1U)) {
+    (void) std::printf("limits: put() into a full ring\n");
+    status = -1;
+  }
+  for (std::uint32_t i = 1U; i <= 4U; i++) {
+    if (i != FromElement(ring.get(0U))) {
+      (void) std::printf("limits: get() %" PRIu32 " failed\n", i);
+      status = -1;
+    }
+  }
+  if (nullptr != ring.get(1U)) {
+    (void) std::printf("limits: get() from an emptied ring\n");
+    status = -1;
+  }
+  ring.unInitialize();
+  return status;
+}
+
+/* With a finite time out, each side retries until its operation succeeds, so that the time outs and the wake ups
+ * left over from a previous wait are exercised too.
+ */
+static std::int32_t Stress(const char *nameStringPtr, std::uint32_t count, std::uint32_t timeoutInMs)
+{
+  static Ring_t ring;
+  std::uint32_t errors = 0U;
+  std::uint32_t received = 0U;
+  Ring_t::Statistics_t statistics;
+
+  if (EmwOsInterface::eOK != ring.initialize("data", "space")) {
+    return -1;
+  }
+  {
+    std::thread producer([count, timeoutInMs] {
+      for (std::uint32_t i = 1U; i <= count; i++) {
+        while (!ring.put(ToElement(i), timeoutInMs)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    while (received < count) {
+      const std::uint32_t *const element_ptr = ring.get(timeoutInMs);
+
+      if (nullptr == element_ptr) {
+        std::this_thread::yield();
+      }
+      else {
+        received++;
+        if (FromElement(element_ptr) != received) {
+          if (0U == errors) {
+            (void) std::printf("%s: %" PRIu32 " received instead of %" PRIu32 "\n", nameStringPtr,
+                               FromElement(element_ptr), received);
+          }
+          errors++;
+        }
+      }
+    }
+    producer.join();
+  }
+  if (nullptr != ring.get(0U)) {
+    (void) std::printf("%s: ring not empty at the end\n", nameStringPtr);
+    errors++;
+  }
+  ring.getStatistics(statistics);
+  ring.unInitialize();
+  (void) std::printf("%s: %" PRIu32 " elements, %" PRIu32 " errors, %" PRIu32 " consumer and %" PRIu32
+                     " producer wake ups\n", nameStringPtr, received, errors,
+                     statistics.consumerWakeUps, statistics.producerWakeUps);
+  return (0U == errors) ? 0 : -1;
+}
+
+int main(void)
+{
+  std::int32_t status = CheckLimits();
+
+  if (0 == status) {
+    status = Stress("forever", 200000U, EMW_OS_TIMEOUT_FOREVER);
+  }
+  if (0 == status) {
+    status = Stress("timeout", 100000U, 1U);
+  }
+  if (0 == status) {
+    status = Stress("polling", 100000U, 0U);
+  }
+  return (0 == status) ? 0 : 1;
+}